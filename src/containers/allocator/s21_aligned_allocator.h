@@ -0,0 +1,104 @@
+#ifndef S21_ALIGNED_ALLOCATOR_H
+#define S21_ALIGNED_ALLOCATOR_H
+
+#include <sys/mman.h>
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+// Allocator whose blocks start on an Align-byte boundary (at least alignof
+// T), e.g. 32 or 64 for aligned SIMD loads or 4096 for page-aligned
+// buffers. With HugePages, blocks of 2 MiB or more are aligned and padded to
+// whole 2 MiB pages and advised with MADV_HUGEPAGE where the platform has it.
+template <typename T, std::size_t Align = 64, bool HugePages = false>
+class aligned_allocator {
+  static_assert(Align > 0 && (Align & (Align - 1)) == 0,
+                "alignment must be a power of two");
+
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using is_always_equal = std::true_type;
+
+  static constexpr size_type alignment = std::max(Align, alignof(T));
+  static constexpr size_type huge_page_size = size_type(2) << 20;
+
+  // The non-type parameters keep allocator_traits from deducing this.
+  template <typename U>
+  struct rebind {
+    using other = aligned_allocator<U, Align, HugePages>;
+  };
+
+  aligned_allocator() noexcept = default;
+
+  template <typename U>
+  aligned_allocator(const aligned_allocator<U, Align, HugePages> &) noexcept {}
+
+  T *allocate(size_type n) {
+    if (n > max_size()) throw std::bad_array_new_length();
+    size_type bytes = BlockSize(n);
+    void *p = ::operator new(bytes, std::align_val_t(BlockAlignment(bytes)));
+#ifdef MADV_HUGEPAGE
+    if (HugePages && bytes >= huge_page_size)
+      ::madvise(p, bytes, MADV_HUGEPAGE);
+#endif
+    return static_cast<T *>(p);
+  }
+
+  void deallocate(T *p, size_type n) noexcept {
+    size_type bytes = BlockSize(n);
+    ::operator delete(static_cast<void *>(p), bytes,
+                      std::align_val_t(BlockAlignment(bytes)));
+  }
+
+  size_type max_size() const noexcept {
+    return (PTRDIFF_MAX - huge_page_size) / sizeof(T);
+  }
+
+  friend bool operator==(const aligned_allocator &,
+                         const aligned_allocator &) noexcept {
+    return true;
+  }
+
+  friend bool operator!=(const aligned_allocator &,
+                         const aligned_allocator &) noexcept {
+    return false;
+  }
+
+ private:
+  static size_type BlockSize(size_type n) noexcept {
+    size_type bytes = n * sizeof(T);
+    if (HugePages && bytes >= huge_page_size)
+      bytes = (bytes + huge_page_size - 1) / huge_page_size * huge_page_size;
+    return bytes;
+  }
+
+  static size_type BlockAlignment(size_type bytes) noexcept {
+    if (HugePages && bytes >= huge_page_size)
+      return std::max(alignment, huge_page_size);
+    return alignment;
+  }
+};
+
+// Alignment every buffer obtained from Alloc is guaranteed to have: the
+// allocator's alignment member when it declares one, alignof(value_type)
+// otherwise.
+template <typename Alloc, typename = void>
+struct allocator_alignment
+    : std::integral_constant<std::size_t,
+                             alignof(typename Alloc::value_type)> {};
+
+template <typename Alloc>
+struct allocator_alignment<Alloc, std::void_t<decltype(Alloc::alignment)>>
+    : std::integral_constant<std::size_t, Alloc::alignment> {};
+
+};  // namespace s21
+
+#endif  // S21_ALIGNED_ALLOCATOR_H
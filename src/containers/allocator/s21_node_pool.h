@@ -0,0 +1,190 @@
+#ifndef S21_NODE_POOL_H
+#define S21_NODE_POOL_H
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+namespace s21 {
+
+// Pool of equally sized blocks carved out of larger chunks. Freed blocks go
+// onto an intrusive free list and are handed out again before a new chunk is
+// taken, so once a node-based container has reached its working size it no
+// longer calls the global allocator at all. The block size is fixed by the
+// first request; requests that do not fit are refused with nullptr. Chunks
+// are only returned when the pool is destroyed. Not thread-safe.
+class node_pool {
+ public:
+  using size_type = std::size_t;
+
+  explicit node_pool(size_type blocks_per_chunk = 64) noexcept
+      : chunks_(nullptr),
+        free_(nullptr),
+        block_size_(0),
+        block_align_(0),
+        blocks_per_chunk_(std::max<size_type>(blocks_per_chunk, 1)),
+        chunk_count_(0),
+        free_count_(0) {}
+
+  node_pool(const node_pool &) = delete;
+
+  node_pool &operator=(const node_pool &) = delete;
+
+  ~node_pool() {
+    while (chunks_ != nullptr) {
+      Chunk *next = chunks_->next_;
+      ::operator delete(static_cast<void *>(chunks_),
+                        std::align_val_t(block_align_));
+      chunks_ = next;
+    }
+  }
+
+  void *allocate(size_type size, size_type align) {
+    if (!Fits(size, align)) return nullptr;
+    if (free_ == nullptr) AddChunk(blocks_per_chunk_);
+    FreeBlock *block = free_;
+    free_ = block->next_;
+    free_count_--;
+    return block;
+  }
+
+  // block must have come from allocate() on this pool.
+  void deallocate(void *block) noexcept {
+    free_ = ::new (block) FreeBlock{free_};
+    free_count_++;
+  }
+
+  // Makes sure count more blocks of the given size can be handed out
+  // without taking a chunk; the missing ones come in a single chunk.
+  void reserve(size_type count, size_type size, size_type align) {
+    if (Fits(size, align) && free_count_ < count)
+      AddChunk(count - free_count_);
+  }
+
+  bool fits(size_type size, size_type align) const noexcept {
+    return block_size_ != 0 && size <= block_size_ && align <= block_align_;
+  }
+
+  size_type block_size() const noexcept { return block_size_; }
+
+  size_type chunk_count() const noexcept { return chunk_count_; }
+
+  size_type free_count() const noexcept { return free_count_; }
+
+ private:
+  struct FreeBlock {
+    FreeBlock *next_;
+  };
+
+  struct Chunk {
+    Chunk *next_;
+  };
+
+  Chunk *chunks_;
+  FreeBlock *free_;
+  size_type block_size_;
+  size_type block_align_;
+  size_type blocks_per_chunk_;
+  size_type chunk_count_;
+  size_type free_count_;
+
+  static size_type RoundUp(size_type size, size_type align) noexcept {
+    return (size + align - 1) / align * align;
+  }
+
+  bool Fits(size_type size, size_type align) {
+    if (block_size_ == 0) {
+      block_align_ = std::max(align, alignof(FreeBlock));
+      block_size_ = RoundUp(std::max(size, sizeof(FreeBlock)), block_align_);
+    }
+    return fits(size, align);
+  }
+
+  // The chunk header sits in front of the blocks, padded to the block
+  // alignment, and links the chunks for the destructor.
+  void AddChunk(size_type blocks) {
+    size_type header = RoundUp(sizeof(Chunk), block_align_);
+    if (blocks > (PTRDIFF_MAX - header) / block_size_)
+      throw std::bad_array_new_length();
+    void *memory = ::operator new(header + blocks * block_size_,
+                                  std::align_val_t(block_align_));
+    chunks_ = ::new (memory) Chunk{chunks_};
+    chunk_count_++;
+    unsigned char *first = static_cast<unsigned char *>(memory) + header;
+    for (size_type i = blocks; i > 0; i--)
+      deallocate(first + (i - 1) * block_size_);
+  }
+};
+
+// Allocator that serves single-object requests, such as the nodes of
+// s21::list, from a node_pool and passes everything else to std::allocator.
+// A default-constructed allocator creates its own pool, so each list gets a
+// private one; copies share the pool of the original, and allocators built
+// from the same shared pool let several containers of the same element type
+// recycle each other's nodes. Allocators compare equal exactly when they
+// share a pool, which never changes after construction, so s21::list only
+// relinks nodes between lists whose allocators compare equal.
+template <typename T>
+class node_allocator {
+ public:
+  using value_type = T;
+  using size_type = std::size_t;
+  using difference_type = std::ptrdiff_t;
+  using propagate_on_container_move_assignment = std::true_type;
+  using propagate_on_container_swap = std::true_type;
+
+  node_allocator() : pool_(std::make_shared<node_pool>()) {}
+
+  // pool must not be null.
+  explicit node_allocator(std::shared_ptr<node_pool> pool) noexcept
+      : pool_(std::move(pool)) {}
+
+  // Moving copies, so the source keeps its pool and stays equal to the copy.
+  node_allocator(const node_allocator &) noexcept = default;
+
+  template <typename U>
+  node_allocator(const node_allocator<U> &other) noexcept
+      : pool_(other.pool()) {}
+
+  T *allocate(size_type n) {
+    if (n == 1) {
+      void *block = pool_->allocate(sizeof(T), alignof(T));
+      if (block != nullptr) return static_cast<T *>(block);
+    }
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T *p, size_type n) noexcept {
+    if (n == 1 && pool_->fits(sizeof(T), alignof(T)))
+      pool_->deallocate(p);
+    else
+      std::allocator<T>().deallocate(p, n);
+  }
+
+  // Pre-allocates blocks for count more objects of type T.
+  void reserve(size_type count) {
+    pool_->reserve(count, sizeof(T), alignof(T));
+  }
+
+  const std::shared_ptr<node_pool> &pool() const noexcept { return pool_; }
+
+  friend bool operator==(const node_allocator &lhs,
+                         const node_allocator &rhs) noexcept {
+    return lhs.pool_ == rhs.pool_;
+  }
+
+  friend bool operator!=(const node_allocator &lhs,
+                         const node_allocator &rhs) noexcept {
+    return lhs.pool_ != rhs.pool_;
+  }
+
+ private:
+  std::shared_ptr<node_pool> pool_;
+};
+
+};  // namespace s21
+
+#endif  // S21_NODE_POOL_H
@@ -0,0 +1,240 @@
+#ifndef S21_INTRUSIVE_LIST_H
+#define S21_INTRUSIVE_LIST_H
+
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_list.h"
+
+namespace s21 {
+
+// Links embedded in an object so that intrusive_list can chain it without
+// allocating, plus a pointer back to that object. A hook is in at most one
+// list at a time. Copying the object does not copy its place in a list: the
+// copy starts unlinked.
+class list_hook : private NodeBase {
+ public:
+  list_hook() noexcept : NodeBase(nullptr, nullptr), owner_(nullptr) {}
+
+  list_hook(const list_hook&) noexcept : list_hook() {}
+
+  list_hook& operator=(const list_hook&) noexcept { return *this; }
+
+  bool is_linked() const noexcept { return pNext_ != nullptr; }
+
+ private:
+  template <typename T, list_hook T::*Hook>
+  friend class intrusive_list;
+
+  void* owner_;
+};
+
+// Doubly linked list of objects that carry their own list_hook member, e.g.
+// intrusive_list<Entry, &Entry::hook>. The list never allocates, copies or
+// destroys the objects: it only links them, so they must outlive their
+// membership. Given an object, iterator_to and unlink work in O(1) without a
+// search, which makes move-to-front for LRU caches a constant-time splice.
+template <typename T, list_hook T::*Hook>
+class intrusive_list {
+ public:
+  using value_type = T;
+  using pointer = T*;
+  using reference = T&;
+  using const_pointer = const T*;
+  using const_reference = const T&;
+  using iterator = s21::ListIterator<intrusive_list>;
+  using const_iterator = s21::ConstListIterator<intrusive_list>;
+  using size_type = size_t;
+
+  intrusive_list() noexcept : size_(0) { InitFakeNode(); }
+
+  intrusive_list(const intrusive_list&) = delete;
+
+  intrusive_list(intrusive_list&& l) noexcept : intrusive_list() { swap(l); }
+
+  // The objects stay alive; they are only unlinked.
+  ~intrusive_list() noexcept { clear(); }
+
+  intrusive_list& operator=(const intrusive_list&) = delete;
+
+  intrusive_list& operator=(intrusive_list&& l) noexcept {
+    if (this != &l) {
+      clear();
+      swap(l);
+    }
+    return *this;
+  }
+
+  reference front() {
+    if (size_ == 0)
+      throw std::out_of_range("Getting front() from empty container\n");
+    return Value(fake_node_.pNext_);
+  }
+
+  const_reference front() const {
+    if (size_ == 0)
+      throw std::out_of_range("Getting front() from empty container\n");
+    return Value(fake_node_.pNext_);
+  }
+
+  reference back() {
+    if (size_ == 0)
+      throw std::out_of_range("Getting back() from empty container\n");
+    return Value(fake_node_.pPrev_);
+  }
+
+  const_reference back() const {
+    if (size_ == 0)
+      throw std::out_of_range("Getting back() from empty container\n");
+    return Value(fake_node_.pPrev_);
+  }
+
+  const_iterator cbegin() const noexcept {
+    return const_iterator(fake_node_.pNext_);
+  }
+
+  const_iterator cend() const noexcept { return const_iterator(FakeNode()); }
+
+  iterator begin() const noexcept { return iterator(fake_node_.pNext_); }
+
+  iterator end() const noexcept { return iterator(FakeNode()); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  void clear() noexcept {
+    NodeBase* node = fake_node_.pNext_;
+    while (node != FakeNode()) {
+      NodeBase* next = node->pNext_;
+      node->pNext_ = node->pPrev_ = nullptr;
+      node = next;
+    }
+    InitFakeNode();
+    size_ = 0;
+  }
+
+  // value must not be linked into any list.
+  iterator insert(const_iterator pos, reference value) noexcept {
+    list_hook* hook = &(value.*Hook);
+    hook->owner_ = std::addressof(value);
+    NodeBase* node = hook;
+    LinkBefore(pos.ptr_, node);
+    size_++;
+    return iterator(node);
+  }
+
+  // Unlinks the element at pos and returns the one after it.
+  iterator erase(const_iterator pos) noexcept {
+    NodeBase* next = pos.ptr_->pNext_;
+    Unlink(pos.ptr_);
+    size_--;
+    return iterator(next);
+  }
+
+  // value must be linked into this list.
+  void unlink(reference value) noexcept { erase(iterator_to(value)); }
+
+  iterator iterator_to(reference value) const noexcept {
+    return iterator(&(value.*Hook));
+  }
+
+  const_iterator iterator_to(const_reference value) const noexcept {
+    return const_iterator(const_cast<list_hook*>(&(value.*Hook)));
+  }
+
+  void push_front(reference value) noexcept { insert(cbegin(), value); }
+
+  void push_back(reference value) noexcept { insert(cend(), value); }
+
+  void pop_front() noexcept {
+    if (size_ > 0) erase(cbegin());
+  }
+
+  void pop_back() noexcept {
+    if (size_ > 0) erase(const_iterator(fake_node_.pPrev_));
+  }
+
+  void swap(intrusive_list& other) noexcept {
+    std::swap(fake_node_.pNext_, other.fake_node_.pNext_);
+    std::swap(fake_node_.pPrev_, other.fake_node_.pPrev_);
+    std::swap(size_, other.size_);
+    RelinkFakeNode();
+    other.RelinkFakeNode();
+  }
+
+  // Moves every element of other in front of pos.
+  void splice(const_iterator pos, intrusive_list& other) noexcept {
+    if (this == &other || other.size_ == 0) return;
+    NodeBase* first = other.fake_node_.pNext_;
+    NodeBase* last = other.fake_node_.pPrev_;
+    first->pPrev_ = pos.ptr_->pPrev_;
+    pos.ptr_->pPrev_->pNext_ = first;
+    last->pNext_ = pos.ptr_;
+    pos.ptr_->pPrev_ = last;
+    size_ += other.size_;
+    other.InitFakeNode();
+    other.size_ = 0;
+  }
+
+  // Moves the element at it, which belongs to other, in front of pos; other
+  // may be this list.
+  void splice(const_iterator pos, intrusive_list& other,
+              const_iterator it) noexcept {
+    if (pos == it || pos.ptr_ == it.ptr_->pNext_) return;
+    other.Unlink(it.ptr_);
+    other.size_--;
+    LinkBefore(pos.ptr_, it.ptr_);
+    size_++;
+  }
+
+ private:
+  friend const_iterator;
+  friend iterator;
+
+  NodeBase fake_node_;
+  size_type size_;
+
+  // The hook remembers the object it was linked for, so getting back to it
+  // needs no layout tricks.
+  static reference Value(NodeBase* node) noexcept {
+    return *static_cast<pointer>(static_cast<list_hook*>(node)->owner_);
+  }
+
+  NodeBase* FakeNode() const noexcept {
+    return const_cast<NodeBase*>(&fake_node_);
+  }
+
+  void InitFakeNode() noexcept {
+    fake_node_.pNext_ = fake_node_.pPrev_ = FakeNode();
+  }
+
+  void RelinkFakeNode() noexcept {
+    if (size_ == 0) {
+      InitFakeNode();
+    } else {
+      fake_node_.pNext_->pPrev_ = FakeNode();
+      fake_node_.pPrev_->pNext_ = FakeNode();
+    }
+  }
+
+  static void LinkBefore(NodeBase* pos, NodeBase* node) noexcept {
+    node->pPrev_ = pos->pPrev_;
+    node->pNext_ = pos;
+    pos->pPrev_->pNext_ = node;
+    pos->pPrev_ = node;
+  }
+
+  static void Unlink(NodeBase* node) noexcept {
+    node->pPrev_->pNext_ = node->pNext_;
+    node->pNext_->pPrev_ = node->pPrev_;
+    node->pNext_ = node->pPrev_ = nullptr;
+  }
+
+};  // intrusive_list
+
+};  // namespace s21
+
+#endif  // S21_INTRUSIVE_LIST_H
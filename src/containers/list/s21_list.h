@@ -1,64 +1,184 @@
 #ifndef S21_LIST_H
 #define S21_LIST_H
 
+#include <functional>
 #include <initializer_list>
 #include <memory>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
 namespace s21 {
 
-template <typename T>
-struct Node {
+// Links shared by every node. The list's sentinel is a bare NodeBase, so
+// it holds no value.
+struct NodeBase {
  public:
-  T* data_;
-  Node<T>* pNext_;
-  Node<T>* pPrev_;
+  NodeBase* pNext_;
+  NodeBase* pPrev_;
 
-  Node(Node<T>* pNext = nullptr, Node<T>* pPrev = nullptr)
+  NodeBase(NodeBase* pNext = nullptr, NodeBase* pPrev = nullptr)
       : pNext_(pNext), pPrev_(pPrev) {}
+};
+
+// An element node: the links and the value in a single allocation.
+template <typename T>
+struct Node : NodeBase {
+ public:
+  T data_;
 
-  Node(const T& data, Node<T>* pNext = nullptr, Node<T>* pPrev = nullptr)
-      : data_(data), pNext_(pNext), pPrev_(pPrev) {}
+  template <typename... Args>
+  Node(NodeBase* pNext, NodeBase* pPrev, Args&&... args)
+      : NodeBase(pNext, pPrev), data_(std::forward<Args>(args)...) {}
 };
 
+// Bidirectional iterators over a chain of NodeBase links, shared by
+// s21::list and s21::intrusive_list. Container provides the static
+// Value(NodeBase*) that maps a node to its element.
+template <typename Container>
+class ConstListIterator {
+ public:
+  friend Container;
+  using difference_type = ptrdiff_t;
+  using iterator_category = std::bidirectional_iterator_tag;
+
+  ConstListIterator() noexcept : ptr_(nullptr) {}
+
+  ConstListIterator(NodeBase* ptr) : ptr_(ptr) {}
+
+  typename Container::const_reference operator*() const {
+    return Container::Value(ptr_);
+  }
+
+  typename Container::const_pointer operator->() const {
+    return &Container::Value(ptr_);
+  }
+
+  ConstListIterator& operator++() {
+    ptr_ = ptr_->pNext_;
+    return *this;
+  }
+
+  ConstListIterator operator++(int) {
+    ConstListIterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  ConstListIterator& operator--() {
+    ptr_ = ptr_->pPrev_;
+    return *this;
+  }
+
+  ConstListIterator operator--(int) {
+    ConstListIterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  friend bool operator==(const ConstListIterator& lhs,
+                         const ConstListIterator& rhs) {
+    return lhs.ptr_ == rhs.ptr_;
+  }
+
+  friend bool operator!=(const ConstListIterator& lhs,
+                         const ConstListIterator& rhs) {
+    return lhs.ptr_ != rhs.ptr_;
+  }
+
+ protected:
+  NodeBase* ptr_;
+
+};  // ConstListIterator
+
+template <typename Container>
+class ListIterator : public ConstListIterator<Container> {
+ public:
+  ListIterator() { this->ptr_ = nullptr; }
+
+  ListIterator(NodeBase* ptr) { this->ptr_ = ptr; }
+
+  typename Container::reference operator*() {
+    return Container::Value(this->ptr_);
+  }
+
+  typename Container::pointer operator->() {
+    return &Container::Value(this->ptr_);
+  }
+
+  ListIterator& operator++() {
+    ConstListIterator<Container>::operator++();
+    return *this;
+  }
+
+  ListIterator operator++(int) {
+    ListIterator temp = *this;
+    ConstListIterator<Container>::operator++();
+    return temp;
+  }
+
+  ListIterator& operator--() {
+    ConstListIterator<Container>::operator--();
+    return *this;
+  }
+
+  ListIterator operator--(int) {
+    ListIterator temp = *this;
+    ConstListIterator<Container>::operator--();
+    return temp;
+  }
+
+  friend bool operator==(const ListIterator& lhs, const ListIterator& rhs) {
+    return lhs.ptr_ == rhs.ptr_;
+  }
+
+  friend bool operator!=(const ListIterator& lhs, const ListIterator& rhs) {
+    return lhs.ptr_ != rhs.ptr_;
+  }
+
+};  // ListIterator
+
 template <typename T, typename Alloc = std::allocator<T>>
 class list {
  public:
-  class ListIterator;
-  class ConstListIterator;
   using value_type = T;
   using pointer = T*;
   using reference = T&;
   using const_pointer = const T*;
   using const_reference = const T&;
-  using iterator = ListIterator;
-  using const_iterator = ConstListIterator;
+  using iterator = s21::ListIterator<list>;
+  using const_iterator = s21::ConstListIterator<list>;
   using size_type = size_t;
   using alloc_value = Alloc;
   using alloc_node =
       typename std::allocator_traits<Alloc>::rebind_alloc<Node<T>>;
 
-  list() : size_(0) { InitFakeNode(); }
+  list() noexcept(std::is_nothrow_default_constructible<alloc_node>::value)
+      : size_(0) {
+    InitFakeNode();
+  }
 
-  list(size_type n) : size_(0) {
+  explicit list(const Alloc& alloc) noexcept : size_(0), alloc_n(alloc) {
     InitFakeNode();
+  }
+
+  list(size_type n) : list() {
     for (size_type i = 0; i < n; i++) push_back(value_type());
   }
 
-  list(std::initializer_list<value_type> const& items) : size_(0) {
-    InitFakeNode();
+  list(std::initializer_list<value_type> const& items) : list() {
     for (auto it = items.begin(); it != items.end(); ++it) push_back(*it);
   }
 
-  list(const list& l) : size_(0) {
-    InitFakeNode();
+  list(const list& l)
+      : list(Alloc(std::allocator_traits<alloc_node>::
+                       select_on_container_copy_construction(l.alloc_n))) {
     for (auto it = l.begin(); it != l.end(); it++) push_back(*it);
   }
 
-  list(list&& l) noexcept : fake_node_(l.fake_node_), size_(l.size_) {
-    l.fake_node_ = nullptr;
-    l.size_ = 0;
-  }
+  // Starts from a copy of l's allocator, which can not throw, instead of a
+  // default-constructed one.
+  list(list&& l) noexcept : list(Alloc(l.alloc_n)) { swap(l); }
 
   ~list() noexcept { DeallocateList(); }
 
@@ -82,42 +202,50 @@ class list {
   const_reference front() const {
     if (size_ == 0)
       throw std::out_of_range("Getting front() from empty container\n");
-    return *(fake_node_->pNext_->data_);
+    return Value(fake_node_.pNext_);
   }
 
   const_reference back() const {
     if (size_ == 0)
       throw std::out_of_range("Getting back() from empty container\n");
-    return *(fake_node_->pPrev_->data_);
+    return Value(fake_node_.pPrev_);
   }
 
   void push_front(const_reference value) {
-    fake_node_->pNext_ = CreateNode(value, fake_node_->pNext_, fake_node_);
-    fake_node_->pNext_->pNext_->pPrev_ = fake_node_->pNext_;
+    fake_node_.pNext_ = CreateNode(value, fake_node_.pNext_, FakeNode());
+    fake_node_.pNext_->pNext_->pPrev_ = fake_node_.pNext_;
     size_++;
   }
 
   void push_back(const_reference value) {
-    fake_node_->pPrev_ = CreateNode(value, fake_node_, fake_node_->pPrev_);
-    fake_node_->pPrev_->pPrev_->pNext_ = fake_node_->pPrev_;
+    fake_node_.pPrev_ = CreateNode(value, FakeNode(), fake_node_.pPrev_);
+    fake_node_.pPrev_->pPrev_->pNext_ = fake_node_.pPrev_;
     size_++;
   }
 
   const_iterator cbegin() const noexcept {
-    return const_iterator(fake_node_->pNext_);
+    return const_iterator(fake_node_.pNext_);
   }
 
-  const_iterator cend() const noexcept { return const_iterator(fake_node_); }
+  const_iterator cend() const noexcept { return const_iterator(FakeNode()); }
 
-  iterator begin() const noexcept { return iterator(fake_node_->pNext_); }
+  iterator begin() const noexcept { return iterator(fake_node_.pNext_); }
 
-  iterator end() const noexcept { return iterator(fake_node_); }
+  iterator end() const noexcept { return iterator(FakeNode()); }
 
   bool empty() const noexcept { return size_ == 0; }
 
   size_type size() const noexcept { return size_; }
 
-  size_type max_size() const noexcept { return alloc_n.max_size(); }
+  size_type max_size() const noexcept {
+    return std::allocator_traits<alloc_node>::max_size(alloc_n);
+  }
+
+  alloc_value get_allocator() const noexcept { return alloc_value(alloc_n); }
+
+  // Lets the allocator set aside room for n more nodes when it can, as
+  // node_allocator does; with any other allocator this does nothing.
+  void reserve_nodes(size_type n) { ReserveNodes(alloc_n, n, 0); }
 
   void clear() {
     DeallocateList();
@@ -133,7 +261,7 @@ class list {
   }
 
   void erase(iterator pos) {
-    if (pos != iterator(fake_node_)) {
+    if (pos != iterator(FakeNode())) {
       pos.ptr_->pPrev_->pNext_ = pos.ptr_->pNext_;
       pos.ptr_->pNext_->pPrev_ = pos.ptr_->pPrev_;
       DeallocateNode(pos.ptr_);
@@ -141,9 +269,9 @@ class list {
     }
   }
 
-  void pop_back() { erase(iterator(fake_node_->pPrev_)); }
+  void pop_back() { erase(iterator(fake_node_.pPrev_)); }
 
-  void pop_front() { erase(iterator(fake_node_->pNext_)); }
+  void pop_front() { erase(iterator(fake_node_.pNext_)); }
 
   void unique() {
     auto it = this->begin();
@@ -155,33 +283,70 @@ class list {
     }
   }
 
-  void swap(list& other) {
-    std::swap(fake_node_, other.fake_node_);
+  // The sentinels stay in their objects; the chains change hands together
+  // with the allocators that own their nodes.
+  void swap(list& other) noexcept {
+    std::swap(fake_node_.pNext_, other.fake_node_.pNext_);
+    std::swap(alloc_n, other.alloc_n);
+    std::swap(fake_node_.pPrev_, other.fake_node_.pPrev_);
     std::swap(size_, other.size_);
+    RelinkFakeNode();
+    other.RelinkFakeNode();
   }
 
   void reverse() {
     for (auto it = this->begin(); it != this->end(); it--) {
       std::swap(it.ptr_->pNext_, it.ptr_->pPrev_);
     }
-    std::swap(fake_node_->pNext_, fake_node_->pPrev_);
+    std::swap(fake_node_.pNext_, fake_node_.pPrev_);
   }
 
-  void sort() {
-    iterator temp;
-    for (auto iti = this->begin(); iti != this->end(); iti++) {
-      temp = this->begin();
-      for (auto itz = this->begin(); itz != this->end(); itz++) {
-        if (*temp > *itz) {
-          std::swap(*temp, *itz);
+  void sort() { sort(std::less<value_type>()); }
+
+  // Stable bottom-up merge sort that relinks nodes and never moves a value.
+  // bins[i] holds a sorted run of 2^i nodes, so 64 of them cover any size.
+  // If comp throws, every node is kept but their order is unspecified.
+  template <typename Compare>
+  void sort(Compare comp) {
+    if (size_ < 2) return;
+    fake_node_.pPrev_->pNext_ = nullptr;
+    NodeBase* rest = fake_node_.pNext_;
+    NodeBase* run = nullptr;
+    NodeBase* sorted = nullptr;
+    NodeBase* bins[64] = {};
+    try {
+      while (rest != nullptr) {
+        run = rest;
+        rest = rest->pNext_;
+        run->pNext_ = nullptr;
+        size_type i = 0;
+        for (; bins[i] != nullptr; i++) {
+          MergeChains(bins[i], run, comp);
+          std::swap(run, bins[i]);
         }
-        if (itz != this->begin()) temp++;
+        std::swap(run, bins[i]);
       }
+      for (NodeBase*& bin : bins) {
+        if (bin == nullptr) continue;
+        MergeChains(bin, sorted, comp);
+        std::swap(sorted, bin);
+      }
+    } catch (...) {
+      for (NodeBase* bin : bins) sorted = AppendChain(bin, sorted);
+      LinkChain(AppendChain(AppendChain(sorted, run), rest));
+      throw;
     }
+    LinkChain(sorted);
   }
 
+  // Nodes only change lists when the allocators compare equal; otherwise
+  // other's values are copied into nodes of this list first.
   void splice(const_iterator pos, list& other) {
-    if (other.size_ > 0) {
+    if (!(alloc_n == other.alloc_n)) {
+      list copy = CopyWithOwnAllocator(other);
+      other.clear();
+      splice(pos, copy);
+    } else if (other.size_ > 0) {
       auto itb = other.begin();
       auto ite = other.end().operator--();
       pos.ptr_->pPrev_->pNext_ = itb.ptr_;
@@ -189,184 +354,199 @@ class list {
       pos.ptr_->pPrev_ = ite.ptr_;
       ite.ptr_->pNext_ = pos.ptr_;
       size_ += other.size_;
-      other.DeallocateNode(other.fake_node_);
-      other.fake_node_ = nullptr;
+      other.InitFakeNode();
       other.size_ = 0;
     }
   }
 
-  void merge(list& other) {
-    if (this != &other) {
-      auto it = this->begin();
-      auto ito = other.begin();
-      while (ito != other.end()) {
-        if (it == this->end() || *it > *ito) {
-          insert(it, *ito);
-          ito++;
-        } else {
-          it++;
-        }
+  void merge(list& other) { merge(other, std::less<value_type>()); }
+
+  // Moves the nodes of other into place without copying or allocating;
+  // other ends up empty. Equal elements of *this stay ahead of those from
+  // other. If comp throws, both lists stay valid with every node in one of
+  // them. With unequal allocators the values of other are copied instead.
+  template <typename Compare>
+  void merge(list& other, Compare comp) {
+    if (this == &other) return;
+    if (!(alloc_n == other.alloc_n)) {
+      list copy = CopyWithOwnAllocator(other);
+      other.clear();
+      try {
+        merge(copy, comp);
+      } catch (...) {
+        splice(cend(), copy);
+        throw;
       }
-      other.DeallocateList();
-      other.fake_node_ = nullptr;
-    }
-  }
-
-  class ConstListIterator {
-   public:
-    friend list<T>;
-    using difference_type = ptrdiff_t;
-    using iterator_category = std::bidirectional_iterator_tag;
-
-    ConstListIterator() noexcept : ptr_(nullptr) {}
-
-    ConstListIterator(Node<T>* ptr) : ptr_(ptr) {}
-
-    const_reference operator*() const { return *(ptr_->data_); }
-
-    const_pointer operator->() const { return ptr_->data_; }
-
-    ConstListIterator& operator++() {
-      ptr_ = ptr_->pNext_;
-      return *this;
-    }
-
-    ConstListIterator operator++(int) {
-      ConstListIterator temp = *this;
-      ++(*this);
-      return temp;
-    }
-
-    ConstListIterator& operator--() {
-      ptr_ = ptr_->pPrev_;
-      return *this;
-    }
-
-    ConstListIterator operator--(int) {
-      ConstListIterator temp = *this;
-      --(*this);
-      return temp;
-    }
-
-    friend bool operator==(const ConstListIterator& lhs,
-                           const ConstListIterator& rhs) {
-      return lhs.ptr_ == rhs.ptr_;
+      return;
     }
-
-    friend bool operator!=(const ConstListIterator& lhs,
-                           const ConstListIterator& rhs) {
-      return lhs.ptr_ != rhs.ptr_;
+    NodeBase* pos = fake_node_.pNext_;
+    while (other.size_ > 0 && pos != FakeNode()) {
+      NodeBase* node = other.fake_node_.pNext_;
+      if (comp(Value(node), Value(pos))) {
+        other.fake_node_.pNext_ = node->pNext_;
+        node->pNext_->pPrev_ = other.FakeNode();
+        other.size_--;
+        node->pPrev_ = pos->pPrev_;
+        node->pNext_ = pos;
+        pos->pPrev_->pNext_ = node;
+        pos->pPrev_ = node;
+        size_++;
+      } else {
+        pos = pos->pNext_;
+      }
     }
+    splice(cend(), other);
+  }
 
-   protected:
-    Node<T>* ptr_;
-
-  };  // ConstListIterator
-
-  class ListIterator : public ConstListIterator {
-   public:
-    ListIterator() { this->ptr_ = nullptr; }
-
-    ListIterator(Node<T>* ptr) { this->ptr_ = ptr; }
-
-    reference operator*() { return *(this->ptr_->data_); }
-
-    pointer operator->() { return this->ptr_->data_; }
-
-    ListIterator& operator++() {
-      ConstListIterator::operator++();
-      return *this;
-    }
+ private:
+  friend const_iterator;
+  friend iterator;
 
-    ListIterator operator++(int) {
-      ListIterator temp = *this;
-      ConstListIterator::operator++();
-      return temp;
-    }
+  // Embedded value-less sentinel: an empty list owns no memory at all.
+  NodeBase fake_node_;
+  size_type size_;
+  alloc_node alloc_n;
 
-    ListIterator& operator--() {
-      ConstListIterator::operator--();
-      return *this;
-    }
+  // Only element nodes may be passed here, never the sentinel.
+  static reference Value(NodeBase* node) noexcept {
+    return static_cast<Node<T>*>(node)->data_;
+  }
 
-    ListIterator operator--(int) {
-      ListIterator temp = *this;
-      ConstListIterator::operator--();
-      return temp;
-    }
+  NodeBase* FakeNode() const noexcept {
+    return const_cast<NodeBase*>(&fake_node_);
+  }
 
-    friend bool operator==(const ListIterator& lhs, const ListIterator& rhs) {
-      return lhs.ptr_ == rhs.ptr_;
-    }
+  void InitFakeNode() noexcept {
+    fake_node_.pNext_ = fake_node_.pPrev_ = FakeNode();
+  }
 
-    friend bool operator!=(const ListIterator& lhs, const ListIterator& rhs) {
-      return lhs.ptr_ != rhs.ptr_;
+  // Points the ends of the chain back at this list's own sentinel.
+  void RelinkFakeNode() noexcept {
+    if (size_ == 0) {
+      InitFakeNode();
+    } else {
+      fake_node_.pNext_->pPrev_ = FakeNode();
+      fake_node_.pPrev_->pNext_ = FakeNode();
     }
+  }
 
-  };  // ListIterator
+  // Copies other's values into nodes that this list's allocator can free.
+  list CopyWithOwnAllocator(const list& other) const {
+    list copy(get_allocator());
+    for (auto it = other.begin(); it != other.end(); ++it) copy.push_back(*it);
+    return copy;
+  }
 
- private:
-  Node<T>* fake_node_;
-  size_type size_;
-  alloc_value alloc_v;
-  alloc_node alloc_n;
+  template <typename A>
+  static auto ReserveNodes(A& alloc, size_type n, int)
+      -> decltype(alloc.reserve(n), void()) {
+    alloc.reserve(n);
+  }
 
-  void InitFakeNode() {
-    fake_node_ = std::allocator_traits<alloc_node>::allocate(alloc_n, 1);
-    fake_node_->data_ =
-        std::allocator_traits<alloc_value>::allocate(alloc_v, 1);
+  template <typename A>
+  static void ReserveNodes(A&, size_type, long) {}
+
+  // Merges the null-terminated sorted chain second into first, taking from
+  // first on ties. second is always left empty; if comp throws, first still
+  // holds every node of both chains.
+  template <typename Compare>
+  static void MergeChains(NodeBase*& first, NodeBase*& second,
+                          Compare& comp) {
+    NodeBase head;
+    NodeBase* tail = &head;
+    NodeBase* left = first;
+    NodeBase* right = second;
+    second = nullptr;
     try {
-      std::allocator_traits<alloc_value>::construct(alloc_v, fake_node_->data_,
-                                                    T());
+      while (left != nullptr && right != nullptr) {
+        NodeBase*& next = comp(Value(right), Value(left)) ? right : left;
+        tail = tail->pNext_ = next;
+        next = next->pNext_;
+      }
     } catch (...) {
-      std::allocator_traits<alloc_value>::deallocate(alloc_v, fake_node_->data_,
-                                                     1);
-      std::allocator_traits<alloc_node>::deallocate(alloc_n, fake_node_, 1);
+      tail->pNext_ = AppendChain(left, right);
+      first = head.pNext_;
       throw;
     }
-    fake_node_->pNext_ = fake_node_;
-    fake_node_->pPrev_ = fake_node_;
+    tail->pNext_ = left != nullptr ? left : right;
+    first = head.pNext_;
   }
 
-  Node<T>* CreateNode(const_reference value, Node<T>* pNext, Node<T>* pPrev) {
+  static NodeBase* AppendChain(NodeBase* first, NodeBase* second) noexcept {
+    if (first == nullptr) return second;
+    NodeBase* last = first;
+    while (last->pNext_ != nullptr) last = last->pNext_;
+    last->pNext_ = second;
+    return first;
+  }
+
+  // Makes the null-terminated chain the whole list again, restoring the
+  // back links.
+  void LinkChain(NodeBase* chain) noexcept {
+    NodeBase* prev = FakeNode();
+    for (; chain != nullptr; chain = chain->pNext_) {
+      chain->pPrev_ = prev;
+      prev->pNext_ = chain;
+      prev = chain;
+    }
+    prev->pNext_ = FakeNode();
+    fake_node_.pPrev_ = prev;
+  }
+
+  // The value is constructed straight into the node; if that throws, only
+  // the node's memory is given back and the list is left as it was.
+  NodeBase* CreateNode(const_reference value, NodeBase* pNext,
+                       NodeBase* pPrev) {
     Node<T>* nw = std::allocator_traits<alloc_node>::allocate(alloc_n, 1);
-    nw->data_ = std::allocator_traits<alloc_value>::allocate(alloc_v, 1);
     try {
-      std::allocator_traits<alloc_node>::construct(
-          alloc_n, nw, std::move_if_noexcept(pNext),
-          std::move_if_noexcept(pPrev));
-      std::allocator_traits<alloc_value>::construct(
-          alloc_v, nw->data_, std::move_if_noexcept(value));
+      std::allocator_traits<alloc_node>::construct(alloc_n, nw, pNext, pPrev,
+                                                   value);
     } catch (...) {
-      DeallocateNode(nw);
-      DeallocateList();
+      std::allocator_traits<alloc_node>::deallocate(alloc_n, nw, 1);
       throw;
     }
-
     return nw;
   }
 
-  void DeallocateNode(Node<T>* node) {
-    std::allocator_traits<alloc_value>::destroy(alloc_v, node->data_);
-    std::allocator_traits<alloc_value>::deallocate(alloc_v, node->data_, 1);
-    std::allocator_traits<alloc_node>::deallocate(alloc_n, node, 1);
+  void DeallocateNode(NodeBase* node) {
+    Node<T>* nd = static_cast<Node<T>*>(node);
+    std::allocator_traits<alloc_node>::destroy(alloc_n, nd);
+    std::allocator_traits<alloc_node>::deallocate(alloc_n, nd, 1);
   }
 
   void DeallocateList() {
-    if (fake_node_ != nullptr) {
-      Node<T>* temp = fake_node_->pNext_;
-      Node<T>* t;
-      while (temp != fake_node_) {
-        t = temp;
-        temp = temp->pNext_;
-        DeallocateNode(t);
-      }
-      DeallocateNode(fake_node_);
+    NodeBase* temp = fake_node_.pNext_;
+    NodeBase* t;
+    while (temp != FakeNode()) {
+      t = temp;
+      temp = temp->pNext_;
+      DeallocateNode(t);
     }
   }
 
 };  // list
 
+// Unlinks and frees every node matching pred; the other nodes stay where
+// they are. Returns how many were removed.
+template <typename T, typename Alloc, typename Predicate>
+typename list<T, Alloc>::size_type erase_if(list<T, Alloc>& l,
+                                            Predicate pred) {
+  typename list<T, Alloc>::size_type removed = 0;
+  for (auto it = l.begin(); it != l.end();) {
+    auto current = it++;
+    if (pred(*current)) {
+      l.erase(current);
+      removed++;
+    }
+  }
+  return removed;
+}
+
+template <typename T, typename Alloc, typename U>
+typename list<T, Alloc>::size_type erase(list<T, Alloc>& l, const U& value) {
+  return erase_if(l, [&](const auto& item) { return item == value; });
+}
+
 };  // namespace s21
 
 #endif  // S21_LIST_H
\ No newline at end of file
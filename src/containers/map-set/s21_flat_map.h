@@ -0,0 +1,178 @@
+#ifndef S21_FLAT_MAP_H
+#define S21_FLAT_MAP_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Associative container with the interface of s21::map, kept as a vector of
+// pairs sorted by key. Lookups are binary searches over contiguous memory;
+// insert and erase shift the tail, so it suits maps that are built once and
+// then mostly read. Inserting or erasing invalidates iterators.
+template <typename Key, typename T, typename Compare = std::less<Key>,
+          typename Alloc = std::allocator<std::pair<Key, T>>>
+class flat_map {
+ public:
+  using key_type = Key;
+  using mapped_type = T;
+  using value_type = std::pair<key_type, mapped_type>;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using container_type = s21::vector<value_type, Alloc>;
+  using iterator = typename container_type::iterator;
+  using const_iterator = typename container_type::const_iterator;
+  using size_type = size_t;
+
+  flat_map() : data_(), comp_() {}
+
+  // Sorts once and drops repeated keys, keeping the first one as a chain
+  // of inserts would: O(n log n) instead of n shifts of the tail.
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  flat_map(InputIt first, InputIt last) : data_(first, last), comp_() {
+    SortUnique(0);
+  }
+
+  flat_map(std::initializer_list<value_type> const& items)
+      : flat_map(items.begin(), items.end()) {}
+
+  iterator begin() noexcept { return data_.begin(); }
+
+  iterator end() noexcept { return data_.end(); }
+
+  const_iterator cbegin() const noexcept { return data_.cbegin(); }
+
+  const_iterator cend() const noexcept { return data_.cend(); }
+
+  mapped_type& at(const Key& key) {
+    iterator it = find(key);
+    if (it == end()) throw std::out_of_range("'At' out of range.");
+    return it->second;
+  }
+
+  const mapped_type& at(const Key& key) const {
+    const_iterator it = LowerBound(key);
+    if (!Matches(it, key)) throw std::out_of_range("'At' out of range.");
+    return it->second;
+  }
+
+  mapped_type& operator[](const Key& key) {
+    auto res = insert(key, {});
+    return res.first->second;
+  }
+
+  iterator find(const Key& key) {
+    const_iterator it = LowerBound(key);
+    return Matches(it, key) ? begin() + (it - cbegin()) : end();
+  }
+
+  bool contains(const Key& key) const { return Matches(LowerBound(key), key); }
+
+  bool empty() const noexcept { return data_.empty(); }
+
+  size_type size() const noexcept { return data_.size(); }
+
+  size_type max_size() const noexcept { return data_.max_size(); }
+
+  void reserve(size_type size) { data_.reserve(size); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    return insert(value.first, value.second);
+  }
+
+  std::pair<iterator, bool> insert(const Key& key, const T& obj) {
+    const_iterator it = LowerBound(key);
+    if (Matches(it, key)) return {begin() + (it - cbegin()), false};
+    return {data_.insert(it, value_type(key, obj)), true};
+  }
+
+  // Appends the range, sorts only the new part and merges it into place.
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last) {
+    size_type old_size = data_.size();
+    data_.insert(data_.cend(), first, last);
+    SortUnique(old_size);
+  }
+
+  std::pair<iterator, bool> insert_or_assign(const Key& key, const T& obj) {
+    auto res = insert(key, obj);
+    if (!res.second) res.first->second = obj;
+    return res;
+  }
+
+  void erase(iterator pos) { data_.erase(pos); }
+
+  void swap(flat_map& other) {
+    data_.swap(other.data_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // Like s21::map, keys already present here win and other ends up empty.
+  // Both sides are sorted, so this is a single linear merge.
+  void merge(flat_map& other) {
+    if (this == &other || other.empty()) return;
+    container_type merged;
+    merged.reserve(size() + other.size());
+    iterator left = begin(), right = other.begin();
+    while (left != end() && right != other.end()) {
+      if (KeyLess(*right, *left)) {
+        merged.push_back(std::move(*right++));
+      } else {
+        if (!KeyLess(*left, *right)) ++right;
+        merged.push_back(std::move(*left++));
+      }
+    }
+    for (; left != end(); ++left) merged.push_back(std::move(*left));
+    for (; right != other.end(); ++right) merged.push_back(std::move(*right));
+    data_.swap(merged);
+    other.clear();
+  }
+
+  void clear() { data_.clear(); }
+
+ private:
+  container_type data_;
+  Compare comp_;
+
+  bool KeyLess(const value_type& lhs, const value_type& rhs) const {
+    return comp_(lhs.first, rhs.first);
+  }
+
+  const_iterator LowerBound(const Key& key) const {
+    return std::lower_bound(cbegin(), cend(), key,
+                            [this](const value_type& value, const Key& k) {
+                              return comp_(value.first, k);
+                            });
+  }
+
+  bool Matches(const_iterator it, const Key& key) const {
+    return it != cend() && !comp_(key, it->first);
+  }
+
+  // Sorts [from, end), merges it with the sorted prefix and removes repeated
+  // keys. Both the sort and the merge are stable, so the first occurrence of
+  // a key is the one that stays.
+  void SortUnique(size_type from) {
+    auto less = [this](const value_type& lhs, const value_type& rhs) {
+      return KeyLess(lhs, rhs);
+    };
+    std::stable_sort(begin() + from, end(), less);
+    std::inplace_merge(begin(), begin() + from, end(), less);
+    iterator last = std::unique(
+        begin(), end(), [this](const value_type& lhs, const value_type& rhs) {
+          return !KeyLess(lhs, rhs);
+        });
+    data_.erase(last, cend());
+  }
+
+};  // flat_map
+
+};  // namespace s21
+
+#endif  // S21_FLAT_MAP_H
@@ -0,0 +1,129 @@
+#ifndef S21_FLAT_SET_H
+#define S21_FLAT_SET_H
+
+#include <algorithm>
+#include <functional>
+#include <initializer_list>
+#include <iterator>
+#include <utility>
+
+#include "../vector/s21_vector.h"
+
+namespace s21 {
+
+// Set with the interface of s21::set, stored as a sorted s21::vector. See
+// flat_map for the trade-offs against the red-black tree.
+template <typename Key, typename Compare = std::less<Key>>
+class flat_set {
+ public:
+  using key_type = Key;
+  using value_type = Key;
+  using reference = value_type&;
+  using const_reference = const value_type&;
+  using container_type = s21::vector<value_type>;
+  using iterator = typename container_type::iterator;
+  using const_iterator = typename container_type::const_iterator;
+  using size_type = size_t;
+
+  flat_set() : data_(), comp_() {}
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  flat_set(InputIt first, InputIt last) : data_(first, last), comp_() {
+    SortUnique(0);
+  }
+
+  flat_set(std::initializer_list<value_type> const& items)
+      : flat_set(items.begin(), items.end()) {}
+
+  iterator begin() noexcept { return data_.begin(); }
+
+  iterator end() noexcept { return data_.end(); }
+
+  const_iterator cbegin() const noexcept { return data_.cbegin(); }
+
+  const_iterator cend() const noexcept { return data_.cend(); }
+
+  bool empty() const noexcept { return data_.empty(); }
+
+  size_type size() const noexcept { return data_.size(); }
+
+  size_type max_size() const noexcept { return data_.max_size(); }
+
+  void reserve(size_type size) { data_.reserve(size); }
+
+  void clear() { data_.clear(); }
+
+  std::pair<iterator, bool> insert(const value_type& value) {
+    const_iterator it = LowerBound(value);
+    if (Matches(it, value)) return {begin() + (it - cbegin()), false};
+    return {data_.insert(it, value), true};
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  void insert(InputIt first, InputIt last) {
+    size_type old_size = data_.size();
+    data_.insert(data_.cend(), first, last);
+    SortUnique(old_size);
+  }
+
+  void erase(iterator pos) { data_.erase(pos); }
+
+  void swap(flat_set& other) {
+    data_.swap(other.data_);
+    std::swap(comp_, other.comp_);
+  }
+
+  // Keys already present here win and other ends up empty, as in s21::set.
+  void merge(flat_set& other) {
+    if (this == &other || other.empty()) return;
+    container_type merged;
+    merged.reserve(size() + other.size());
+    iterator left = begin(), right = other.begin();
+    while (left != end() && right != other.end()) {
+      if (comp_(*right, *left)) {
+        merged.push_back(std::move(*right++));
+      } else {
+        if (!comp_(*left, *right)) ++right;
+        merged.push_back(std::move(*left++));
+      }
+    }
+    for (; left != end(); ++left) merged.push_back(std::move(*left));
+    for (; right != other.end(); ++right) merged.push_back(std::move(*right));
+    data_.swap(merged);
+    other.clear();
+  }
+
+  iterator find(const Key& key) {
+    const_iterator it = LowerBound(key);
+    return Matches(it, key) ? begin() + (it - cbegin()) : end();
+  }
+
+  bool contains(const Key& key) const { return Matches(LowerBound(key), key); }
+
+ private:
+  container_type data_;
+  Compare comp_;
+
+  const_iterator LowerBound(const Key& key) const {
+    return std::lower_bound(cbegin(), cend(), key, comp_);
+  }
+
+  bool Matches(const_iterator it, const Key& key) const {
+    return it != cend() && !comp_(key, *it);
+  }
+
+  void SortUnique(size_type from) {
+    std::stable_sort(begin() + from, end(), comp_);
+    std::inplace_merge(begin(), begin() + from, end(), comp_);
+    iterator last =
+        std::unique(begin(), end(), [this](const Key& lhs, const Key& rhs) {
+          return !comp_(lhs, rhs);
+        });
+    data_.erase(last, cend());
+  }
+
+};  // flat_set
+
+};  // namespace s21
+
+#endif  // S21_FLAT_SET_H
@@ -23,7 +23,7 @@ class map {
       typename s21::rbtree<Key, T, Compare, Alloc>::const_iterator;
   using size_type = size_t;
 
-  map() : tree_() {}
+  map() noexcept : tree_() {}
 
   map(std::initializer_list<value_type> const& items) {
     for (auto it : items) insert(it);
@@ -17,13 +17,13 @@ struct RBNode {
   std::pair<Key, T>* data_;
   Colors color_;
 
-  RBNode(std::pair<Key, T> data = nullptr, RBNode<Key, T>* pLeft = nullptr,
+  RBNode(std::pair<Key, T>* data = nullptr, RBNode<Key, T>* pLeft = nullptr,
          RBNode<Key, T>* pRight = nullptr, RBNode<Key, T>* pParent = nullptr,
-         Colors color = red)
-      : data_(data),
+         Colors color = red) noexcept
+      : pParent_(pParent),
         pLeft_(pLeft),
         pRight_(pRight),
-        pParent_(pParent),
+        data_(data),
         color_(color) {}
 };
 
@@ -49,13 +49,14 @@ class rbtree {
   using iterator = RBTreeIterator;
   using const_iterator = ConstRBTreeIterator;
 
-  rbtree() : size_(0) { InitFakeNode(); }
+  rbtree() noexcept
+      : fake_node_(nullptr, nullptr, nullptr, nullptr, black),
+        min_node_(nullptr),
+        max_node_(nullptr),
+        size_(0) {}
 
   ~rbtree() {
-    if (fake_node_ != nullptr && fake_node_->pRight_ != nullptr) {
-      DeallocateTree(fake_node_->pRight_);
-    }
-    DeallocateNode(fake_node_);
+    if (GetRoot() != nullptr) DeallocateTree(GetRoot());
   }
 
   RBTreeIteratorSet begin_set() { return RBTreeIteratorSet(min_node_, this); }
@@ -77,14 +78,14 @@ class rbtree {
   const_iterator cend() { return const_iterator(this); }
 
   std::pair<RBTreeIteratorSet, bool> InsertByKey(key_type k) {
-    RBNode<key_type, mapped_type>* ptr = Search(fake_node_->pRight_, k);
+    RBNode<key_type, mapped_type>* ptr = Search(fake_node_.pRight_, k);
     bool inserted = false;
     if (ptr == nullptr) {
       inserted = true;
       if (size_ == 0) {
-        ptr = fake_node_->pRight_ = CreateNode(std::make_pair(k, mapped_type()),
-                                               fake_node_, nullptr, nullptr);
-        fake_node_->pRight_->color_ = black;
+        ptr = fake_node_.pRight_ = CreateNode(std::make_pair(k, mapped_type()),
+                                               FakeNode(), nullptr, nullptr);
+        fake_node_.pRight_->color_ = black;
       } else {
         ptr = PushNode(GetRoot(), k, mapped_type());
       }
@@ -97,14 +98,14 @@ class rbtree {
   }
 
   std::pair<iterator, bool> InsertByKeyAndValue(key_type k, mapped_type val) {
-    RBNode<key_type, mapped_type>* ptr = Search(fake_node_->pRight_, k);
+    RBNode<key_type, mapped_type>* ptr = Search(fake_node_.pRight_, k);
     bool inserted = false;
     if (ptr == nullptr) {
       inserted = true;
       if (size_ == 0) {
-        ptr = fake_node_->pRight_ =
-            CreateNode(std::make_pair(k, val), fake_node_, nullptr, nullptr);
-        fake_node_->pRight_->color_ = black;
+        ptr = fake_node_.pRight_ =
+            CreateNode(std::make_pair(k, val), FakeNode(), nullptr, nullptr);
+        fake_node_.pRight_->color_ = black;
       } else {
         ptr = PushNode(GetRoot(), k, val);
       }
@@ -116,7 +117,7 @@ class rbtree {
   }
 
   std::pair<iterator, bool> InsertOrAssign(Key k, T obj) {
-    RBNode<key_type, mapped_type>* ptr = Search(fake_node_->pRight_, k);
+    RBNode<key_type, mapped_type>* ptr = Search(fake_node_.pRight_, k);
     bool inserted = false;
     if (ptr == nullptr) {
       inserted = true;
@@ -127,8 +128,8 @@ class rbtree {
   }
 
   void Clear() {
-    if (fake_node_->pRight_ != nullptr) DeallocateTree(fake_node_->pRight_);
-    fake_node_->pRight_ = nullptr;
+    if (GetRoot() != nullptr) DeallocateTree(GetRoot());
+    fake_node_.pRight_ = min_node_ = max_node_ = nullptr;
     size_ = 0;
   }
 
@@ -159,9 +160,9 @@ class rbtree {
   }
 
   void EraseNode(iterator it) {
-    if (it == iterator(fake_node_->pRight_, this) && size_ == 1) {
-      DeallocateNode(fake_node_->pRight_);
-      fake_node_->pRight_ = nullptr;
+    if (it == iterator(fake_node_.pRight_, this) && size_ == 1) {
+      DeallocateNode(fake_node_.pRight_);
+      fake_node_.pRight_ = min_node_ = max_node_ = nullptr;
     } else {
       EraseProccess(it.ptr_);
       DeallocateNode(it.ptr_);
@@ -175,9 +176,7 @@ class rbtree {
       for (auto it = other.begin(); it != other.end(); it++) {
         InsertByKeyAndValue(it.ptr_->data_->first, it.ptr_->data_->second);
       }
-      other.DeallocateTree(other.fake_node_->pRight_);
-      other.fake_node_->pRight_ = nullptr;
-      other.size_ = 0;
+      other.Clear();
     }
   }
 
@@ -188,7 +187,7 @@ class rbtree {
   }
 
   T& SearchForKeyAt(const Key& key) {
-    RBNode<key_type, mapped_type>* node = Search(fake_node_->pRight_, key);
+    RBNode<key_type, mapped_type>* node = Search(fake_node_.pRight_, key);
     if (node == nullptr) throw std::out_of_range("'At' out of range.");
     return node->data_->second;
   }
@@ -200,8 +199,12 @@ class rbtree {
     max_node_ = GetMaxNode();
   }
 
+  // The sentinels stay in their objects; the roots are handed over and told
+  // about their new parent.
   void Swap(rbtree& other) {
-    std::swap(fake_node_, other.fake_node_);
+    std::swap(fake_node_.pRight_, other.fake_node_.pRight_);
+    AdoptRoot();
+    other.AdoptRoot();
     std::swap(min_node_, other.min_node_);
     std::swap(max_node_, other.max_node_);
     std::swap(size_, other.size_);
@@ -212,8 +215,10 @@ class rbtree {
 
   void Move(rbtree&& other) noexcept {
     if (this != &other) {
-      fake_node_->pRight_ = std::move(other.fake_node_->pRight_);
-      other.fake_node_->pRight_ = nullptr;
+      if (GetRoot() != nullptr) DeallocateTree(GetRoot());
+      fake_node_.pRight_ = other.fake_node_.pRight_;
+      other.fake_node_.pRight_ = nullptr;
+      AdoptRoot();
       min_node_ = std::move(other.min_node_);
       other.min_node_ = nullptr;
       max_node_ = std::move(other.max_node_);
@@ -236,17 +241,17 @@ class rbtree {
 
   class ConstRBTreeIterator {
    public:
-    friend rbtree<key_type, mapped_type>;
+    friend rbtree;
     using difference_type = std::ptrdiff_t;
     using iterator_category = std::bidirectional_iterator_tag;
 
     ConstRBTreeIterator() : ptr_(nullptr), tree_ptr_(nullptr) {}
 
-    ConstRBTreeIterator(rbtree<key_type, mapped_type>* tree_ptr)
+    ConstRBTreeIterator(rbtree* tree_ptr)
         : ptr_(nullptr), tree_ptr_(tree_ptr) {}
 
     ConstRBTreeIterator(const RBNode<key_type, mapped_type>& ptr,
-                        const rbtree<key_type, mapped_type>& tree_ptr)
+                        const rbtree& tree_ptr)
         : ptr_(ptr), tree_ptr_(tree_ptr) {}
 
     const_reference operator*() const noexcept { return ptr_->data_; }
@@ -300,13 +305,13 @@ class rbtree {
       this->tree_ptr_ = nullptr;
     }
 
-    RBTreeIterator(rbtree<key_type, mapped_type>* tree_ptr) {
+    RBTreeIterator(rbtree* tree_ptr) {
       this->ptr_ = nullptr;
       this->tree_ptr_ = tree_ptr;
     }
 
     RBTreeIterator(RBNode<key_type, mapped_type>* ptr,
-                   rbtree<key_type, mapped_type>* tree_ptr) {
+                   rbtree* tree_ptr) {
       this->ptr_ = ptr;
       this->tree_ptr_ = tree_ptr;
     }
@@ -356,13 +361,13 @@ class rbtree {
       this->tree_ptr_ = nullptr;
     }
 
-    ConstRBTreeIteratorSet(rbtree<key_type, mapped_type>* tree_ptr) {
+    ConstRBTreeIteratorSet(rbtree* tree_ptr) {
       this->ptr_ = nullptr;
       this->tree_ptr_ = tree_ptr;
     }
 
     ConstRBTreeIteratorSet(RBNode<key_type, mapped_type>* ptr,
-                           rbtree<key_type, mapped_type>* tree_ptr) {
+                           rbtree* tree_ptr) {
       this->ptr_ = ptr;
       this->tree_ptr_ = tree_ptr;
     }
@@ -412,13 +417,13 @@ class rbtree {
       this->tree_ptr_ = nullptr;
     }
 
-    RBTreeIteratorSet(rbtree<key_type, mapped_type>* tree_ptr) {
+    RBTreeIteratorSet(rbtree* tree_ptr) {
       this->ptr_ = nullptr;
       this->tree_ptr_ = tree_ptr;
     }
 
     RBTreeIteratorSet(RBNode<key_type, mapped_type>* ptr,
-                      rbtree<key_type, mapped_type>* tree_ptr) {
+                      rbtree* tree_ptr) {
       this->ptr_ = ptr;
       this->tree_ptr_ = tree_ptr;
     }
@@ -462,7 +467,9 @@ class rbtree {
   };  // RBTreeIteratorSet
 
  protected:
-  RBNode<key_type, mapped_type>* fake_node_;
+  // Embedded value-less sentinel whose pRight_ is the root, so an empty tree
+  // owns no memory.
+  RBNode<key_type, mapped_type> fake_node_;
   RBNode<key_type, mapped_type>* min_node_;
   RBNode<key_type, mapped_type>* max_node_;
   size_type size_;
@@ -470,20 +477,12 @@ class rbtree {
   alloc_node alloc_n;
   Compare comp;
 
-  void InitFakeNode() {
-    fake_node_ = std::allocator_traits<alloc_node>::allocate(alloc_n, 1);
-    try {
-      fake_node_->data_ =
-          std::allocator_traits<alloc_value>::allocate(alloc_v, 1);
-      std::allocator_traits<alloc_value>::construct(alloc_v, fake_node_->data_,
-                                                    value_type());
-    } catch (...) {
-      std::allocator_traits<alloc_value>::deallocate(alloc_v, fake_node_->data_,
-                                                     1);
-      throw;
-    }
-    fake_node_->color_ = black;
-    fake_node_->pLeft_ = fake_node_->pParent_ = fake_node_->pRight_ = nullptr;
+  RBNode<key_type, mapped_type>* FakeNode() const noexcept {
+    return const_cast<RBNode<key_type, mapped_type>*>(&fake_node_);
+  }
+
+  void AdoptRoot() noexcept {
+    if (GetRoot() != nullptr) GetRoot()->pParent_ = FakeNode();
   }
 
   RBNode<Key, T>* CreateNode(value_type data,
@@ -492,15 +491,18 @@ class rbtree {
                              RBNode<key_type, mapped_type>* pRight) {
     RBNode<Key, T>* nw =
         std::allocator_traits<alloc_node>::allocate(alloc_n, 1);
-    nw->data_ = std::allocator_traits<alloc_value>::allocate(alloc_v, 1);
+    try {
+      nw->data_ = std::allocator_traits<alloc_value>::allocate(alloc_v, 1);
+    } catch (...) {
+      std::allocator_traits<alloc_node>::deallocate(alloc_n, nw, 1);
+      throw;
+    }
     try {
       std::allocator_traits<alloc_value>::construct(
           alloc_v, nw->data_, std::move_if_noexcept(data));
     } catch (...) {
-      DeallocateNode(nw);
-      if (fake_node_ != nullptr && fake_node_->pRight_ != nullptr)
-        DeallocateTree(fake_node_->pRight_);
-      DeallocateNode(fake_node_);
+      std::allocator_traits<alloc_value>::deallocate(alloc_v, nw->data_, 1);
+      std::allocator_traits<alloc_node>::deallocate(alloc_n, nw, 1);
       throw;
     }
     nw->pParent_ = pParent;
@@ -559,7 +561,7 @@ class rbtree {
         }
       }
     }
-    fake_node_->pRight_->color_ = black;
+    fake_node_.pRight_->color_ = black;
   }
 
   RBNode<key_type, mapped_type>* GetNextNode(
@@ -603,8 +605,8 @@ class rbtree {
   void ReplaceNode(RBNode<key_type, mapped_type>* current_node,
                    RBNode<key_type, mapped_type>* new_son) {
     if (new_son != nullptr) new_son->pParent_ = current_node->pParent_;
-    if (current_node->pParent_ == fake_node_) {
-      fake_node_->pRight_ = new_son;
+    if (current_node->pParent_ == FakeNode()) {
+      fake_node_.pRight_ = new_son;
     }
     if (current_node == current_node->pParent_->pLeft_) {
       current_node->pParent_->pLeft_ = new_son;
@@ -646,7 +648,7 @@ class rbtree {
     }
 
     if (size_ == 1) {
-      fake_node_->pRight_->color_ = black;
+      fake_node_.pRight_->color_ = black;
     } else {
       if (node_color == black) BalanceAfterDelete(deleted_node, backup_node);
     }
@@ -671,7 +673,7 @@ class rbtree {
           sibling_node->color_ = red;
           node = backup_node;
           backup_node = backup_node->pParent_;
-          if (backup_node == fake_node_) break;
+          if (backup_node == FakeNode()) break;
         } else {
           if (sibling_node->pRight_ == nullptr ||
               sibling_node->pRight_->color_ == black) {
@@ -704,7 +706,7 @@ class rbtree {
           sibling_node->color_ = red;
           node = backup_node;
           backup_node = backup_node->pParent_;
-          if (backup_node == fake_node_) break;
+          if (backup_node == FakeNode()) break;
         } else {
           if (sibling_node->pLeft_ == nullptr ||
               sibling_node->pLeft_->color_ == black) {
@@ -785,7 +787,7 @@ class rbtree {
     child->pRight_ = node;
   }
 
-  RBNode<key_type, mapped_type>* GetRoot() const { return fake_node_->pRight_; }
+  RBNode<key_type, mapped_type>* GetRoot() const { return fake_node_.pRight_; }
 
 };  // rbtree
 
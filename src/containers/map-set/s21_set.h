@@ -21,7 +21,7 @@ class set {
       typename s21::rbtree<Key, Compare>::ConstRBTreeIteratorSet;
   using size_type = size_t;
 
-  set() : tree_() {}
+  set() noexcept : tree_() {}
 
   set(std::initializer_list<value_type> const& items) {
     for (auto it : items) insert(it);
@@ -17,6 +17,11 @@ class queue {
 
   queue(std::initializer_list<value_type> const &items) : container_(items) {}
 
+  // Adopts an existing container, e.g. a ring_buffer of a chosen capacity.
+  explicit queue(const Container &container) : container_(container) {}
+
+  explicit queue(Container &&container) : container_(std::move(container)) {}
+
   queue(const queue &q) : container_(q.container_) {}
 
   queue(queue &&q) noexcept : container_(std::move(q.container_)) {}
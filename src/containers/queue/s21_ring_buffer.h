@@ -0,0 +1,381 @@
+#ifndef S21_RING_BUFFER_H
+#define S21_RING_BUFFER_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "../vector/s21_span.h"
+
+namespace s21 {
+
+// What push_back does when the buffer is full: throw std::length_error, or
+// drop the oldest element to make room.
+enum class ring_mode { bounded, overwrite };
+
+// Random access iterator over a ring_buffer, kept as a logical index from the
+// front, so it walks the elements oldest first across the wrap point.
+template <typename Container, bool IsIterConst = false>
+struct RingBufferIterator {
+ public:
+  using value_type = typename Container::value_type;
+  using difference_type = ptrdiff_t;
+  using pointer =
+      std::conditional_t<IsIterConst, const value_type *, value_type *>;
+  using reference =
+      std::conditional_t<IsIterConst, const value_type &, value_type &>;
+  using iterator_category = std::random_access_iterator_tag;
+  using owner_pointer =
+      std::conditional_t<IsIterConst, const Container *, Container *>;
+
+  RingBufferIterator() noexcept : owner_(nullptr), index_(0) {}
+
+  RingBufferIterator(owner_pointer owner, std::size_t index) noexcept
+      : owner_(owner), index_(index) {}
+
+  template <bool IsOtherConst,
+            typename = std::enable_if_t<IsIterConst && !IsOtherConst>>
+  RingBufferIterator(
+      const RingBufferIterator<Container, IsOtherConst> &other) noexcept
+      : owner_(other.owner_), index_(other.index_) {}
+
+  reference operator*() const { return (*owner_)[index_]; }
+
+  pointer operator->() const { return std::addressof((*owner_)[index_]); }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  RingBufferIterator &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  RingBufferIterator operator++(int) {
+    RingBufferIterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  RingBufferIterator &operator--() {
+    --index_;
+    return *this;
+  }
+
+  RingBufferIterator operator--(int) {
+    RingBufferIterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  RingBufferIterator operator+(difference_type rhs) const {
+    return RingBufferIterator(owner_, index_ + rhs);
+  }
+
+  friend RingBufferIterator operator+(difference_type lhs,
+                                      const RingBufferIterator &rhs) {
+    return rhs + lhs;
+  }
+
+  RingBufferIterator operator-(difference_type rhs) const {
+    return RingBufferIterator(owner_, index_ - rhs);
+  }
+
+  friend difference_type operator-(const RingBufferIterator &lhs,
+                                   const RingBufferIterator &rhs) {
+    return static_cast<difference_type>(lhs.index_) -
+           static_cast<difference_type>(rhs.index_);
+  }
+
+  RingBufferIterator &operator+=(difference_type rhs) {
+    index_ += rhs;
+    return *this;
+  }
+
+  RingBufferIterator &operator-=(difference_type rhs) {
+    index_ -= rhs;
+    return *this;
+  }
+
+  friend bool operator==(const RingBufferIterator &lhs,
+                         const RingBufferIterator &rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+  }
+
+  friend bool operator!=(const RingBufferIterator &lhs,
+                         const RingBufferIterator &rhs) noexcept {
+    return lhs.index_ != rhs.index_;
+  }
+
+  friend bool operator<(const RingBufferIterator &lhs,
+                        const RingBufferIterator &rhs) noexcept {
+    return lhs.index_ < rhs.index_;
+  }
+
+  friend bool operator>(const RingBufferIterator &lhs,
+                        const RingBufferIterator &rhs) noexcept {
+    return lhs.index_ > rhs.index_;
+  }
+
+  friend bool operator<=(const RingBufferIterator &lhs,
+                         const RingBufferIterator &rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+  }
+
+  friend bool operator>=(const RingBufferIterator &lhs,
+                         const RingBufferIterator &rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+  }
+
+  std::size_t index() const noexcept { return index_; }
+
+ private:
+  template <typename, bool>
+  friend struct RingBufferIterator;
+
+  owner_pointer owner_;
+  std::size_t index_;
+};
+
+// Fixed-capacity FIFO in a single allocation. The capacity is rounded up to a
+// power of two so a logical index maps to a slot with a mask instead of a
+// division, and pushing or popping never allocates. The elements occupy at
+// most two contiguous runs of the buffer; spans() exposes both for bulk
+// reads. Provides the push_back / pop_front interface s21::queue expects
+// from its Container.
+template <typename T, typename Alloc = std::allocator<T>>
+class ring_buffer {
+ public:
+  using value_type = T;
+  using pointer = T *;
+  using reference = T &;
+  using const_pointer = const T *;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = RingBufferIterator<ring_buffer, false>;
+  using const_iterator = RingBufferIterator<ring_buffer, true>;
+  using span_pair = std::pair<span<T>, span<T>>;
+  using const_span_pair = std::pair<span<const T>, span<const T>>;
+
+  // A default-constructed buffer has no room; give s21::queue a sized one
+  // through its container constructor.
+  ring_buffer() noexcept
+      : data_(nullptr),
+        capacity_(0),
+        head_(0),
+        size_(0),
+        mode_(ring_mode::bounded) {}
+
+  explicit ring_buffer(size_type capacity, ring_mode mode = ring_mode::bounded)
+      : ring_buffer() {
+    mode_ = mode;
+    capacity_ = RoundUpCapacity(capacity);
+    if (capacity_ != 0)
+      data_ = std::allocator_traits<Alloc>::allocate(alloc, capacity_);
+  }
+
+  ring_buffer(std::initializer_list<value_type> const &items)
+      : ring_buffer(items.size()) {
+    for (const auto &item : items) push_back(item);
+  }
+
+  ring_buffer(const ring_buffer &other)
+      : ring_buffer(other.capacity_, other.mode_) {
+    for (size_type i = 0; i < other.size_; i++) push_back(other[i]);
+  }
+
+  ring_buffer(ring_buffer &&other) noexcept : ring_buffer() { swap(other); }
+
+  ~ring_buffer() {
+    clear();
+    if (data_ != nullptr)
+      std::allocator_traits<Alloc>::deallocate(alloc, data_, capacity_);
+  }
+
+  ring_buffer &operator=(ring_buffer &&other) noexcept {
+    if (this != &other) {
+      ring_buffer nw(std::move(other));
+      swap(nw);
+    }
+    return *this;
+  }
+
+  ring_buffer &operator=(const ring_buffer &other) {
+    if (this != &other) {
+      ring_buffer nw(other);
+      swap(nw);
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Index out of range.");
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Index out of range.");
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) { return *Slot(pos); }
+
+  const_reference operator[](size_type pos) const { return *Slot(pos); }
+
+  reference front() {
+    if (empty())
+      throw std::out_of_range("Getting front() from empty container\n");
+    return *Slot(0);
+  }
+
+  const_reference front() const {
+    if (empty())
+      throw std::out_of_range("Getting front() from empty container\n");
+    return *Slot(0);
+  }
+
+  reference back() {
+    if (empty())
+      throw std::out_of_range("Getting back() from empty container\n");
+    return *Slot(size_ - 1);
+  }
+
+  const_reference back() const {
+    if (empty())
+      throw std::out_of_range("Getting back() from empty container\n");
+    return *Slot(size_ - 1);
+  }
+
+  // The elements oldest first: the run from the head to the end of the
+  // buffer, then the wrapped-around run at its start (empty unless the
+  // contents wrap).
+  span_pair spans() noexcept {
+    size_type first = FirstRunSize();
+    return span_pair(span<T>(data_ + head_, first),
+                     span<T>(data_, size_ - first));
+  }
+
+  const_span_pair spans() const noexcept {
+    size_type first = FirstRunSize();
+    return const_span_pair(span<const T>(data_ + head_, first),
+                           span<const T>(data_, size_ - first));
+  }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+
+  iterator end() noexcept { return iterator(this, size_); }
+
+  const_iterator begin() const noexcept { return cbegin(); }
+
+  const_iterator end() const noexcept { return cend(); }
+
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+
+  const_iterator cend() const noexcept { return const_iterator(this, size_); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  bool full() const noexcept { return size_ == capacity_; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  size_type max_size() const noexcept {
+    return (SIZE_MAX / 2 + 1) / sizeof(value_type);
+  }
+
+  ring_mode mode() const noexcept { return mode_; }
+
+  void clear() noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value)
+      for (size_type i = 0; i < size_; i++)
+        std::allocator_traits<Alloc>::destroy(alloc, Slot(i));
+    head_ = 0;
+    size_ = 0;
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  // When full, a bounded buffer throws std::length_error and leaves its
+  // contents alone; an overwriting one replaces the oldest element.
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      if (mode_ == ring_mode::bounded || capacity_ == 0)
+        throw std::length_error("Ring buffer is full.");
+      // Built before the oldest element is touched, so a throwing
+      // constructor leaves the buffer unchanged.
+      value_type value(std::forward<Args>(args)...);
+      *Slot(0) = std::move(value);
+      head_ = (head_ + 1) & Mask();
+      return back();
+    }
+    std::allocator_traits<Alloc>::construct(alloc, Slot(size_),
+                                            std::forward<Args>(args)...);
+    return *Slot(size_++);
+  }
+
+  void pop_front() { pop_front(1); }
+
+  // Drops the count oldest elements, e.g. after reading them through
+  // spans().
+  void pop_front(size_type count) {
+    if (count > size_) throw std::out_of_range("Index out of range.");
+    if constexpr (!std::is_trivially_destructible<T>::value)
+      for (size_type i = 0; i < count; i++)
+        std::allocator_traits<Alloc>::destroy(alloc, Slot(i));
+    head_ = size_ == count ? 0 : (head_ + count) & Mask();
+    size_ -= count;
+  }
+
+  void pop_back() {
+    if (empty()) throw std::out_of_range("Index out of range.");
+    std::allocator_traits<Alloc>::destroy(alloc, Slot(--size_));
+  }
+
+  void swap(ring_buffer &other) noexcept {
+    std::swap(data_, other.data_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(head_, other.head_);
+    std::swap(size_, other.size_);
+    std::swap(mode_, other.mode_);
+    std::swap(alloc, other.alloc);
+  }
+
+ private:
+  pointer data_;
+  size_type capacity_;
+  size_type head_;
+  size_type size_;
+  ring_mode mode_;
+  Alloc alloc;
+
+  size_type Mask() const noexcept { return capacity_ - 1; }
+
+  pointer Slot(size_type pos) const noexcept {
+    return data_ + ((head_ + pos) & Mask());
+  }
+
+  size_type FirstRunSize() const noexcept {
+    return size_ < capacity_ - head_ ? size_ : capacity_ - head_;
+  }
+
+  size_type RoundUpCapacity(size_type capacity) const {
+    if (capacity > max_size())
+      throw std::length_error("Capacity is too large.");
+    size_type rounded = capacity == 0 ? 0 : 1;
+    while (rounded < capacity) rounded <<= 1;
+    return rounded;
+  }
+};
+
+};  // namespace s21
+
+#endif  // S21_RING_BUFFER_H
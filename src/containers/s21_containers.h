@@ -1,11 +1,26 @@
 #ifndef S21_CONTAINERS_H
 #define S21_CONTAINERS_H
 
+#include "allocator/s21_aligned_allocator.h"
+#include "allocator/s21_node_pool.h"
+#include "list/s21_intrusive_list.h"
 #include "list/s21_list.h"
+#include "map-set/s21_flat_map.h"
+#include "map-set/s21_flat_set.h"
 #include "map-set/s21_map.h"
 #include "map-set/s21_set.h"
 #include "queue/s21_queue.h"
+#include "queue/s21_ring_buffer.h"
 #include "stack/s21_stack.h"
+#include "vector/s21_concurrent_vector.h"
+#include "vector/s21_mmap_vector.h"
+#include "vector/s21_packed_int_vector.h"
+#include "vector/s21_small_vector.h"
+#include "vector/s21_soa_vector.h"
+#include "vector/s21_span.h"
+#include "vector/s21_static_vector.h"
 #include "vector/s21_vector.h"
+#include "vector/s21_vector_parallel.h"
+#include "vector/s21_vector_simd.h"
 
 #endif // S21_CONTAINERS_H
\ No newline at end of file
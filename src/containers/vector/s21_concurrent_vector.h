@@ -0,0 +1,445 @@
+#ifndef S21_CONCURRENT_VECTOR_H
+#define S21_CONCURRENT_VECTOR_H
+
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+namespace s21 {
+
+// Random access iterator over a concurrent_vector, kept as an index so it
+// stays valid while other threads append.
+template <typename Container, bool IsIterConst = false>
+struct ConcurrentVectorIterator {
+ public:
+  using value_type = typename Container::value_type;
+  using difference_type = ptrdiff_t;
+  using pointer =
+      std::conditional_t<IsIterConst, const value_type *, value_type *>;
+  using reference =
+      std::conditional_t<IsIterConst, const value_type &, value_type &>;
+  using iterator_category = std::random_access_iterator_tag;
+  using owner_pointer =
+      std::conditional_t<IsIterConst, const Container *, Container *>;
+
+  ConcurrentVectorIterator() noexcept : owner_(nullptr), index_(0) {}
+
+  ConcurrentVectorIterator(owner_pointer owner, std::size_t index) noexcept
+      : owner_(owner), index_(index) {}
+
+  template <bool IsOtherConst,
+            typename = std::enable_if_t<IsIterConst && !IsOtherConst>>
+  ConcurrentVectorIterator(
+      const ConcurrentVectorIterator<Container, IsOtherConst> &other) noexcept
+      : owner_(other.owner_), index_(other.index_) {}
+
+  reference operator*() const { return (*owner_)[index_]; }
+
+  pointer operator->() const { return std::addressof((*owner_)[index_]); }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  ConcurrentVectorIterator &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  ConcurrentVectorIterator operator++(int) {
+    ConcurrentVectorIterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  ConcurrentVectorIterator &operator--() {
+    --index_;
+    return *this;
+  }
+
+  ConcurrentVectorIterator operator--(int) {
+    ConcurrentVectorIterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  ConcurrentVectorIterator operator+(difference_type rhs) const {
+    return ConcurrentVectorIterator(owner_, index_ + rhs);
+  }
+
+  friend ConcurrentVectorIterator operator+(
+      difference_type lhs, const ConcurrentVectorIterator &rhs) {
+    return rhs + lhs;
+  }
+
+  ConcurrentVectorIterator operator-(difference_type rhs) const {
+    return ConcurrentVectorIterator(owner_, index_ - rhs);
+  }
+
+  friend difference_type operator-(const ConcurrentVectorIterator &lhs,
+                                   const ConcurrentVectorIterator &rhs) {
+    return static_cast<difference_type>(lhs.index_) -
+           static_cast<difference_type>(rhs.index_);
+  }
+
+  ConcurrentVectorIterator &operator+=(difference_type rhs) {
+    index_ += rhs;
+    return *this;
+  }
+
+  ConcurrentVectorIterator &operator-=(difference_type rhs) {
+    index_ -= rhs;
+    return *this;
+  }
+
+  friend bool operator==(const ConcurrentVectorIterator &lhs,
+                         const ConcurrentVectorIterator &rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+  }
+
+  friend bool operator!=(const ConcurrentVectorIterator &lhs,
+                         const ConcurrentVectorIterator &rhs) noexcept {
+    return lhs.index_ != rhs.index_;
+  }
+
+  friend bool operator<(const ConcurrentVectorIterator &lhs,
+                        const ConcurrentVectorIterator &rhs) noexcept {
+    return lhs.index_ < rhs.index_;
+  }
+
+  friend bool operator>(const ConcurrentVectorIterator &lhs,
+                        const ConcurrentVectorIterator &rhs) noexcept {
+    return lhs.index_ > rhs.index_;
+  }
+
+  friend bool operator<=(const ConcurrentVectorIterator &lhs,
+                         const ConcurrentVectorIterator &rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+  }
+
+  friend bool operator>=(const ConcurrentVectorIterator &lhs,
+                         const ConcurrentVectorIterator &rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+  }
+
+  std::size_t index() const noexcept { return index_; }
+
+ private:
+  template <typename, bool>
+  friend struct ConcurrentVectorIterator;
+
+  owner_pointer owner_;
+  std::size_t index_;
+};
+
+// Grow-only vector that many threads can append to at once. Elements live in
+// segments of 8, 8, 16, 32, ... slots that are never reallocated, so
+// references and iterators stay valid while the vector grows. push_back,
+// emplace_back and grow_by claim slots with a single atomic fetch_add and
+// allocate a missing segment with a compare-and-swap, so they never block.
+//
+// size() counts claimed slots, which other threads may still be
+// constructing. An element may be read with operator[] once its
+// construction happened-before the read (e.g. the reader joined the writer),
+// while at() checks the slot and throws if it is not constructed yet.
+// Copying, assignment, swap and clear must not run concurrently with
+// anything else.
+template <typename T, typename Alloc = std::allocator<T>>
+class concurrent_vector {
+ public:
+  using value_type = T;
+  using pointer = T *;
+  using reference = T &;
+  using const_pointer = const T *;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = ConcurrentVectorIterator<concurrent_vector, false>;
+  using const_iterator = ConcurrentVectorIterator<concurrent_vector, true>;
+
+  concurrent_vector() noexcept : segments_(), size_(0) {}
+
+  concurrent_vector(std::initializer_list<value_type> const &items)
+      : concurrent_vector() {
+    for (const auto &item : items) push_back(item);
+  }
+
+  concurrent_vector(const concurrent_vector &v) : concurrent_vector() {
+    for (size_type i = 0; i < v.size(); i++)
+      if (v.IsConstructed(i)) push_back(v[i]);
+  }
+
+  concurrent_vector(concurrent_vector &&v) noexcept : concurrent_vector() {
+    swap(v);
+  }
+
+  ~concurrent_vector() { clear(); }
+
+  concurrent_vector &operator=(const concurrent_vector &v) {
+    if (this != &v) {
+      concurrent_vector nw(v);
+      swap(nw);
+    }
+    return *this;
+  }
+
+  concurrent_vector &operator=(concurrent_vector &&v) noexcept {
+    if (this != &v) {
+      clear();
+      swap(v);
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    CheckConstructed(pos);
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    CheckConstructed(pos);
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) {
+    size_type k = SegmentIndex(pos);
+    return Loaded(k)->items[pos - SegmentBase(k)];
+  }
+
+  const_reference operator[](size_type pos) const {
+    size_type k = SegmentIndex(pos);
+    return Loaded(k)->items[pos - SegmentBase(k)];
+  }
+
+  iterator begin() noexcept { return iterator(this, 0); }
+
+  iterator end() noexcept { return iterator(this, size()); }
+
+  const_iterator begin() const noexcept { return cbegin(); }
+
+  const_iterator end() const noexcept { return cend(); }
+
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+
+  const_iterator cend() const noexcept { return const_iterator(this, size()); }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    return size_.load(std::memory_order_acquire);
+  }
+
+  size_type max_size() const noexcept {
+    return PTRDIFF_MAX / sizeof(value_type);
+  }
+
+  // Slots in the segments allocated so far.
+  size_type capacity() const noexcept {
+    size_type total = 0;
+    for (size_type k = 0; k < kMaxSegments; k++)
+      if (Loaded(k) != nullptr) total += SegmentSize(k);
+    return total;
+  }
+
+  // Allocates every segment below size; safe to call while appending.
+  void reserve(size_type size) {
+    if (size > max_size()) throw std::length_error("Capacity is too large.");
+    if (size > 0)
+      for (size_type k = 0; k <= SegmentIndex(size - 1); k++) Acquire(k);
+  }
+
+  void clear() noexcept {
+    for (size_type k = 0; k < kMaxSegments; k++) {
+      Segment *segment = Loaded(k);
+      if (segment == nullptr) continue;
+      for (size_type i = 0; i < SegmentSize(k); i++)
+        if (segment->states[i].load(std::memory_order_relaxed) == kConstructed)
+          std::allocator_traits<Alloc>::destroy(alloc, segment->items + i);
+      DeallocateSegment(segment, k);
+      segments_[k].store(nullptr, std::memory_order_relaxed);
+    }
+    size_.store(0, std::memory_order_relaxed);
+  }
+
+  iterator push_back(const_reference value) {
+    size_type index = Claim(1);
+    ConstructAt(index, value);
+    return iterator(this, index);
+  }
+
+  iterator push_back(value_type &&value) {
+    size_type index = Claim(1);
+    ConstructAt(index, std::move(value));
+    return iterator(this, index);
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    size_type index = Claim(1);
+    ConstructAt(index, std::forward<Args>(args)...);
+    return (*this)[index];
+  }
+
+  // Appends count value-initialized elements in consecutive slots and
+  // returns an iterator to the first of them.
+  iterator grow_by(size_type count) {
+    size_type first = Claim(count);
+    for (size_type i = first; i < first + count; i++) ConstructAt(i);
+    return iterator(this, first);
+  }
+
+  iterator grow_by(size_type count, const_reference value) {
+    size_type first = Claim(count);
+    for (size_type i = first; i < first + count; i++) ConstructAt(i, value);
+    return iterator(this, first);
+  }
+
+  void swap(concurrent_vector &other) noexcept {
+    for (size_type k = 0; k < kMaxSegments; k++) {
+      Segment *mine = Loaded(k);
+      segments_[k].store(other.Loaded(k), std::memory_order_relaxed);
+      other.segments_[k].store(mine, std::memory_order_relaxed);
+    }
+    size_type size = size_.load(std::memory_order_relaxed);
+    size_.store(other.size_.load(std::memory_order_relaxed),
+                std::memory_order_relaxed);
+    other.size_.store(size, std::memory_order_relaxed);
+    std::swap(alloc, other.alloc);
+  }
+
+ private:
+  using state_type = std::atomic<unsigned char>;
+
+  struct Segment {
+    pointer items;
+    state_type *states;
+  };
+
+  using segment_alloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<Segment>;
+  using state_alloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<state_type>;
+
+  static constexpr unsigned char kEmpty = 0;
+  static constexpr unsigned char kConstructed = 1;
+  // The element's constructor threw; the slot stays claimed but holds no
+  // object.
+  static constexpr unsigned char kBroken = 2;
+
+  static constexpr size_type kFirstShift = 3;
+  static constexpr size_type kMaxSegments =
+      sizeof(size_type) * CHAR_BIT - kFirstShift + 1;
+
+  std::atomic<Segment *> segments_[kMaxSegments];
+  std::atomic<size_type> size_;
+  Alloc alloc;
+
+  // Segment 0 holds indices [0, 8); segment k > 0 holds [8 << (k - 1),
+  // 8 << k).
+  static size_type SegmentIndex(size_type pos) noexcept {
+    size_type high = pos >> kFirstShift;
+    return high == 0 ? 0 : sizeof(size_type) * CHAR_BIT - __builtin_clzll(high);
+  }
+
+  static size_type SegmentBase(size_type k) noexcept {
+    return k == 0 ? 0 : size_type(1) << (k - 1 + kFirstShift);
+  }
+
+  static size_type SegmentSize(size_type k) noexcept {
+    return k == 0 ? size_type(1) << kFirstShift : SegmentBase(k);
+  }
+
+  Segment *Loaded(size_type k) const noexcept {
+    return segments_[k].load(std::memory_order_acquire);
+  }
+
+  size_type Claim(size_type count) {
+    if (count > max_size() - size())
+      throw std::length_error("Capacity is too large.");
+    return size_.fetch_add(count, std::memory_order_acq_rel);
+  }
+
+  // Returns segment k, allocating it if no thread has yet. Losing the race
+  // only costs a wasted allocation.
+  Segment *Acquire(size_type k) {
+    Segment *segment = Loaded(k);
+    if (segment == nullptr) {
+      Segment *fresh = AllocateSegment(k);
+      if (segments_[k].compare_exchange_strong(segment, fresh,
+                                               std::memory_order_acq_rel))
+        segment = fresh;
+      else
+        DeallocateSegment(fresh, k);
+    }
+    return segment;
+  }
+
+  Segment *AllocateSegment(size_type k) {
+    segment_alloc segments(alloc);
+    state_alloc states(alloc);
+    size_type n = SegmentSize(k);
+    Segment *segment =
+        std::allocator_traits<segment_alloc>::allocate(segments, 1);
+    segment->items = nullptr;
+    segment->states = nullptr;
+    try {
+      segment->items = std::allocator_traits<Alloc>::allocate(alloc, n);
+      segment->states =
+          std::allocator_traits<state_alloc>::allocate(states, n);
+    } catch (...) {
+      if (segment->items != nullptr)
+        std::allocator_traits<Alloc>::deallocate(alloc, segment->items, n);
+      std::allocator_traits<segment_alloc>::deallocate(segments, segment, 1);
+      throw;
+    }
+    for (size_type i = 0; i < n; i++)
+      ::new (static_cast<void *>(segment->states + i)) state_type(kEmpty);
+    return segment;
+  }
+
+  void DeallocateSegment(Segment *segment, size_type k) noexcept {
+    segment_alloc segments(alloc);
+    state_alloc states(alloc);
+    size_type n = SegmentSize(k);
+    std::allocator_traits<state_alloc>::deallocate(states, segment->states, n);
+    std::allocator_traits<Alloc>::deallocate(alloc, segment->items, n);
+    std::allocator_traits<segment_alloc>::deallocate(segments, segment, 1);
+  }
+
+  template <typename... Args>
+  void ConstructAt(size_type pos, Args &&...args) {
+    size_type k = SegmentIndex(pos);
+    Segment *segment = Acquire(k);
+    size_type offset = pos - SegmentBase(k);
+    try {
+      std::allocator_traits<Alloc>::construct(alloc, segment->items + offset,
+                                              std::forward<Args>(args)...);
+    } catch (...) {
+      segment->states[offset].store(kBroken, std::memory_order_release);
+      throw;
+    }
+    segment->states[offset].store(kConstructed, std::memory_order_release);
+  }
+
+  bool IsConstructed(size_type pos) const noexcept {
+    size_type k = SegmentIndex(pos);
+    Segment *segment = Loaded(k);
+    return segment != nullptr &&
+           segment->states[pos - SegmentBase(k)].load(
+               std::memory_order_acquire) == kConstructed;
+  }
+
+  void CheckConstructed(size_type pos) const {
+    if (pos >= size()) throw std::out_of_range("Index out of range.");
+    if (!IsConstructed(pos))
+      throw std::out_of_range("Element is not constructed.");
+  }
+};
+
+};  // namespace s21
+
+#endif  // S21_CONCURRENT_VECTOR_H
@@ -0,0 +1,52 @@
+#ifndef S21_GROWTH_POLICY_H
+#define S21_GROWTH_POLICY_H
+
+#include <algorithm>
+#include <cstddef>
+
+namespace s21 {
+
+// Growth policies for s21::vector. next_capacity gets the current capacity
+// and the smallest capacity that fits the pending insertion and returns the
+// capacity to allocate. Any type with the same static member can be used.
+namespace growth {
+
+struct doubling {
+  static std::size_t next_capacity(std::size_t current,
+                                   std::size_t required) noexcept {
+    return std::max(current << 1, required);
+  }
+};
+
+struct one_and_half {
+  static std::size_t next_capacity(std::size_t current,
+                                   std::size_t required) noexcept {
+    return std::max(current + (current >> 1), required);
+  }
+};
+
+struct golden_ratio {
+  static std::size_t next_capacity(std::size_t current,
+                                   std::size_t required) noexcept {
+    return std::max(static_cast<std::size_t>(current * 1.618033988749895),
+                    required);
+  }
+};
+
+// Grows by Chunk elements at a time, rounding up to a multiple of Chunk.
+template <std::size_t Chunk>
+struct fixed_chunk {
+  static_assert(Chunk > 0, "fixed_chunk needs a positive chunk size");
+
+  static std::size_t next_capacity(std::size_t current,
+                                   std::size_t required) noexcept {
+    std::size_t wanted = std::max(current + Chunk, required);
+    return (wanted + Chunk - 1) / Chunk * Chunk;
+  }
+};
+
+}  // namespace growth
+
+};  // namespace s21
+
+#endif  // S21_GROWTH_POLICY_H
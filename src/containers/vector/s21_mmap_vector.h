@@ -0,0 +1,369 @@
+#ifndef S21_MMAP_VECTOR_H
+#define S21_MMAP_VECTOR_H
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <system_error>
+#include <type_traits>
+#include <utility>
+
+#include "s21_growth_policy.h"
+#include "s21_vector.h"
+#include "s21_vector_iterator.h"
+
+namespace s21 {
+
+enum class mmap_mode { read_write, read_only };
+
+// Vector whose elements live in a file mapped with MAP_SHARED. The file is a
+// raw array of T: opening it maps the existing contents without reading or
+// copying them, and growing extends the file with ftruncate and remaps it.
+// While the vector is open the file may be longer than size() elements; it
+// is cut back to size() when the vector is destroyed. Writing through
+// references of a read-only vector is undefined; the modifiers throw
+// std::logic_error instead.
+template <typename T, typename Growth = growth::doubling>
+class mmap_vector {
+  static_assert(std::is_trivially_copyable<T>::value,
+                "mmap_vector stores its elements as raw file bytes");
+
+ public:
+  using value_type = T;
+  using pointer = T *;
+  using reference = T &;
+  using const_pointer = const T *;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = VectorIterator<T, false>;
+  using const_iterator = VectorIterator<T, true>;
+
+  explicit mmap_vector(const std::string &path,
+                       mmap_mode mode = mmap_mode::read_write)
+      : fd_(-1),
+        data_(nullptr),
+        size_(0),
+        capacity_(0),
+        read_only_(mode == mmap_mode::read_only) {
+    fd_ = read_only_ ? ::open(path.c_str(), O_RDONLY | O_CLOEXEC)
+                     : ::open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd_ < 0) ThrowErrno("open");
+    try {
+      struct stat info;
+      if (::fstat(fd_, &info) != 0) ThrowErrno("fstat");
+      size_type bytes = static_cast<size_type>(info.st_size);
+      if (bytes % sizeof(value_type) != 0)
+        throw std::invalid_argument(
+            "File size is not a multiple of the element size.");
+      Map(bytes / sizeof(value_type));
+      size_ = capacity_;
+    } catch (...) {
+      ::close(fd_);
+      throw;
+    }
+  }
+
+  mmap_vector(const mmap_vector &) = delete;
+
+  mmap_vector(mmap_vector &&v) noexcept
+      : fd_(v.fd_),
+        data_(v.data_),
+        size_(v.size_),
+        capacity_(v.capacity_),
+        read_only_(v.read_only_) {
+    v.fd_ = -1;
+    v.data_ = nullptr;
+    v.size_ = v.capacity_ = 0;
+  }
+
+  ~mmap_vector() { Close(); }
+
+  mmap_vector &operator=(const mmap_vector &) = delete;
+
+  mmap_vector &operator=(mmap_vector &&v) noexcept {
+    if (this != &v) {
+      Close();
+      mmap_vector nw(std::move(v));
+      swap(nw);
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Index out of range.");
+    return data_[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Index out of range.");
+    return data_[pos];
+  }
+
+  reference operator[](size_type pos) { return data_[pos]; }
+
+  const_reference operator[](size_type pos) const { return data_[pos]; }
+
+  const_reference front() const {
+    if (size_ == 0)
+      throw std::out_of_range("Getting front() from empty vector.");
+    return data_[0];
+  }
+
+  const_reference back() const {
+    if (size_ == 0)
+      throw std::out_of_range("Getting back() from empty vector\n");
+    return data_[size_ - 1];
+  }
+
+  T *data() { return data_; }
+
+  const T *data() const { return data_; }
+
+  const_iterator cbegin() const noexcept { return const_iterator(data_); }
+
+  const_iterator cend() const noexcept { return const_iterator(data_ + size_); }
+
+  iterator begin() const noexcept { return iterator(data_); }
+
+  iterator end() const noexcept { return iterator(data_ + size_); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return PTRDIFF_MAX / sizeof(value_type);
+  }
+
+  bool read_only() const noexcept { return read_only_; }
+
+  void reserve(size_type size) {
+    CheckWritable();
+    if (size > capacity_) Remap(size);
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  void shrink_to_fit() {
+    CheckWritable();
+    if (capacity_ > size_) Remap(size_);
+  }
+
+  // Keeps the mapping; shrink_to_fit gives the file space back.
+  void clear() {
+    CheckWritable();
+    size_ = 0;
+  }
+
+  // Writes the mapped pages back to the file and waits for the write.
+  void sync() {
+    if (data_ != nullptr && !read_only_ &&
+        ::msync(data_, Bytes(capacity_), MS_SYNC) != 0)
+      ThrowErrno("msync");
+  }
+
+  void resize(size_type count) { resize(count, value_type()); }
+
+  void resize(size_type count, const_reference value) {
+    if (count > size_)
+      insert(this->cend(), count - size_, value);
+    else
+      Truncate(count);
+  }
+
+  // New elements keep the bytes already in the file, which are zeros where
+  // the file had to grow.
+  void resize_default_init(size_type count) {
+    if (count > size_)
+      OpenGap(size_, count - size_);
+    else
+      Truncate(count);
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return insert(pos, 1, value);
+  }
+
+  iterator insert(const_iterator pos, size_type count,
+                  const_reference value) {
+    size_type index = CheckedIndex(pos);
+    // value may live in the mapping that OpenGap is about to move.
+    value_type copy(value);
+    std::fill_n(OpenGap(index, count), count, copy);
+    return iterator(data_ + index);
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = CheckedIndex(pos);
+    if constexpr (std::is_convertible<
+                      typename std::iterator_traits<InputIt>::iterator_category,
+                      std::forward_iterator_tag>::value) {
+      std::copy(first, last, OpenGap(index, std::distance(first, last)));
+    } else {
+      size_type old_size = size_;
+      for (; first != last; ++first) push_back(*first);
+      std::rotate(data_ + index, data_ + old_size, data_ + size_);
+    }
+    return iterator(data_ + index);
+  }
+
+  iterator insert(const_iterator pos,
+                  std::initializer_list<value_type> items) {
+    return insert(pos, items.begin(), items.end());
+  }
+
+  template <typename Range>
+  void append_range(Range &&range) {
+    insert(this->cend(), std::begin(range), std::end(range));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    return insert(pos, 1, value_type(std::forward<Args>(args)...));
+  }
+
+  void erase(iterator pos) {
+    CheckWritable();
+    if (pos < this->begin() || pos >= this->end())
+      throw std::out_of_range("Iterator out of range");
+    pointer target = std::addressof(*pos);
+    std::memmove(static_cast<void *>(target),
+                 static_cast<const void *>(target + 1),
+                 Bytes(data_ + size_ - (target + 1)));
+    size_--;
+  }
+
+  void push_back(const_reference value) { insert(this->cend(), 1, value); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    return *emplace(this->cend(), std::forward<Args>(args)...);
+  }
+
+  void pop_back() {
+    CheckWritable();
+    if (size_ > 0) size_--;
+  }
+
+  void swap(mmap_vector &other) noexcept {
+    std::swap(fd_, other.fd_);
+    std::swap(data_, other.data_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    std::swap(read_only_, other.read_only_);
+  }
+
+ private:
+  int fd_;
+  pointer data_;
+  size_type size_;
+  size_type capacity_;
+  bool read_only_;
+
+  [[noreturn]] static void ThrowErrno(const char *call) {
+    throw std::system_error(errno, std::generic_category(), call);
+  }
+
+  static size_type Bytes(size_type count) noexcept {
+    return count * sizeof(value_type);
+  }
+
+  void CheckWritable() const {
+    if (read_only_) throw std::logic_error("mmap_vector is read-only.");
+  }
+
+  size_type CheckedIndex(const_iterator pos) const {
+    if (pos < this->cbegin() || pos > this->cend())
+      throw std::out_of_range("Iterator out of range");
+    return pos - this->cbegin();
+  }
+
+  // Maps the first capacity elements of the file; an empty file has no
+  // mapping at all.
+  void Map(size_type capacity) {
+    if (capacity != 0) {
+      int protection = read_only_ ? PROT_READ : PROT_READ | PROT_WRITE;
+      void *mapped = ::mmap(nullptr, Bytes(capacity), protection, MAP_SHARED,
+                            fd_, 0);
+      if (mapped == MAP_FAILED) ThrowErrno("mmap");
+      data_ = static_cast<pointer>(mapped);
+    }
+    capacity_ = capacity;
+  }
+
+  void Unmap() noexcept {
+    if (data_ != nullptr) ::munmap(data_, Bytes(capacity_));
+    data_ = nullptr;
+    capacity_ = 0;
+  }
+
+  // Resizes the file to new_capacity elements and maps it again. Linux can
+  // move the existing mapping; elsewhere it is dropped and recreated, which
+  // is just as cheap since the pages stay in the page cache.
+  void Remap(size_type new_capacity) {
+    if (new_capacity > max_size())
+      throw std::length_error("Capacity is too large.");
+    if (::ftruncate(fd_, static_cast<off_t>(Bytes(new_capacity))) != 0)
+      ThrowErrno("ftruncate");
+#ifdef __linux__
+    if (data_ != nullptr && new_capacity != 0) {
+      void *mapped = ::mremap(data_, Bytes(capacity_), Bytes(new_capacity),
+                              MREMAP_MAYMOVE);
+      if (mapped == MAP_FAILED) ThrowErrno("mremap");
+      data_ = static_cast<pointer>(mapped);
+      capacity_ = new_capacity;
+      return;
+    }
+#endif
+    Unmap();
+    Map(new_capacity);
+  }
+
+  // Grows size by count at index, moving the tail up, and returns the first
+  // slot of the gap. Slots past the old end of the file read as zeros.
+  pointer OpenGap(size_type index, size_type count) {
+    CheckWritable();
+    if (size_ + count > capacity_)
+      Remap(std::max(Growth::next_capacity(capacity_, size_ + count),
+                     size_ + count));
+    if (count > 0 && index < size_)
+      std::memmove(static_cast<void *>(data_ + index + count),
+                   static_cast<const void *>(data_ + index),
+                   Bytes(size_ - index));
+    size_ += count;
+    return data_ + index;
+  }
+
+  void Truncate(size_type count) {
+    CheckWritable();
+    size_ = count;
+  }
+
+  void Close() noexcept {
+    if (fd_ < 0) return;
+    Unmap();
+    if (!read_only_) {
+      // Nothing can be reported from a destructor; a failed truncation only
+      // leaves unused slack at the end of the file.
+      int truncated = ::ftruncate(fd_, static_cast<off_t>(Bytes(size_)));
+      static_cast<void>(truncated);
+    }
+    ::close(fd_);
+    fd_ = -1;
+  }
+};
+
+};  // namespace s21
+
+#endif  // S21_MMAP_VECTOR_H
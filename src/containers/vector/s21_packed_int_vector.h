@@ -0,0 +1,358 @@
+#ifndef S21_PACKED_INT_VECTOR_H
+#define S21_PACKED_INT_VECTOR_H
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+#include "s21_static_vector.h"
+#include "s21_vector.h"
+#include "s21_vector_simd.h"
+
+namespace s21 {
+
+namespace simd {
+
+// Unpacks the 128 width-bit fields stored back to back in words and adds
+// offset to each of them. The fields may straddle two words, and the word
+// after the last field must be readable.
+struct ScalarUnpackKernel {
+  static void Unpack(const std::uint64_t *words, unsigned width,
+                     std::uint64_t offset, std::uint64_t *out) {
+    std::uint64_t mask = width == 64 ? ~0ull : (1ull << width) - 1;
+    for (std::size_t i = 0, bit = 0; i < 128; i++, bit += width) {
+      std::size_t word = bit / 64, shift = bit % 64;
+      std::uint64_t value = words[word] >> shift;
+      if (shift + width > 64) value |= words[word + 1] << (64 - shift);
+      out[i] = (value & mask) + offset;
+    }
+  }
+};
+
+#ifdef S21_SIMD_X86
+
+// Four fields per step: both words a field can touch are gathered and merged
+// with per-lane variable shifts. SSE2 has neither, so there is no SSE2 path.
+struct Avx2UnpackKernel {
+  __attribute__((target("avx2"))) static void Unpack(
+      const std::uint64_t *words, unsigned width, std::uint64_t offset,
+      std::uint64_t *out) {
+    if (width == 0) {
+      for (std::size_t i = 0; i < 128; i++) out[i] = offset;
+      return;
+    }
+    const long long *base = reinterpret_cast<const long long *>(words);
+    const __m256i mask = _mm256_set1_epi64x(
+        static_cast<long long>(width == 64 ? ~0ull : (1ull << width) - 1));
+    const __m256i add = _mm256_set1_epi64x(static_cast<long long>(offset));
+    const __m256i step = _mm256_set1_epi64x(4ll * width);
+    const __m256i low_bits = _mm256_set1_epi64x(63);
+    const __m256i word_bits = _mm256_set1_epi64x(64);
+    __m256i bits = _mm256_set_epi64x(3ll * width, 2ll * width, width, 0);
+    for (std::size_t i = 0; i < 128; i += 4) {
+      __m256i index = _mm256_srli_epi64(bits, 6);
+      __m256i shift = _mm256_and_si256(bits, low_bits);
+      __m256i low = _mm256_i64gather_epi64(base, index, 8);
+      __m256i high = _mm256_i64gather_epi64(base + 1, index, 8);
+      // A shift by 64 yields zero, so fields that fit in one word drop high.
+      __m256i value = _mm256_or_si256(
+          _mm256_srlv_epi64(low, shift),
+          _mm256_sllv_epi64(high, _mm256_sub_epi64(word_bits, shift)));
+      value = _mm256_add_epi64(_mm256_and_si256(value, mask), add);
+      _mm256_storeu_si256(reinterpret_cast<__m256i *>(out + i), value);
+      bits = _mm256_add_epi64(bits, step);
+    }
+  }
+};
+
+#endif  // S21_SIMD_X86
+
+template <typename Op>
+auto DispatchUnpack(Op op) {
+#ifdef S21_SIMD_X86
+  if (HasAvx2()) return op(Avx2UnpackKernel());
+#endif
+  return op(ScalarUnpackKernel());
+}
+
+}  // namespace simd
+
+// How the blocks of a packed_int_vector store their values. Both subtract a
+// per-block minimum and keep the remainders with the fewest bits that fit
+// the largest one; delta does this for the differences between neighbours,
+// which for sorted ids are far smaller than the ids themselves.
+enum class packed_encoding { frame_of_reference, delta };
+
+// Input iterator that decodes one block at a time into a local buffer, so a
+// sequential scan unpacks every block exactly once.
+template <typename Container>
+struct PackedIntIterator {
+ public:
+  using value_type = typename Container::value_type;
+  using difference_type = ptrdiff_t;
+  using pointer = void;
+  using reference = value_type;
+  using iterator_category = std::input_iterator_tag;
+
+  static constexpr std::size_t kNoBlock = SIZE_MAX;
+
+  PackedIntIterator() noexcept
+      : owner_(nullptr), index_(0), block_(kNoBlock), buffer_() {}
+
+  PackedIntIterator(const Container *owner, std::size_t index) noexcept
+      : owner_(owner), index_(index), block_(kNoBlock), buffer_() {}
+
+  reference operator*() const {
+    std::size_t block = index_ / Container::block_size;
+    if (block >= owner_->block_count()) return (*owner_)[index_];
+    if (block != block_) {
+      owner_->decode_block(block, buffer_.data());
+      block_ = block;
+    }
+    return buffer_[index_ % Container::block_size];
+  }
+
+  PackedIntIterator &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  PackedIntIterator operator++(int) {
+    PackedIntIterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  friend bool operator==(const PackedIntIterator &lhs,
+                         const PackedIntIterator &rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+  }
+
+  friend bool operator!=(const PackedIntIterator &lhs,
+                         const PackedIntIterator &rhs) noexcept {
+    return lhs.index_ != rhs.index_;
+  }
+
+  std::size_t index() const noexcept { return index_; }
+
+ private:
+  const Container *owner_;
+  std::size_t index_;
+  mutable std::size_t block_;
+  mutable std::array<value_type, Container::block_size> buffer_;
+};
+
+// Append-only sequence of 64-bit unsigned integers, compressed in blocks of
+// block_size values. Every full block is bit-packed at its own width, so a
+// block of nearby values costs a few bits per value instead of eight bytes;
+// the last, partial block stays unpacked until it fills up. Reading a value
+// costs a bit extraction with frame_of_reference and a partial decode of its
+// block with delta; scans should go through the iterators or decode_block,
+// which unpack whole blocks with AVX2 when the CPU has it. All arithmetic
+// wraps, so any input round-trips, only less compactly when unsorted.
+class packed_int_vector {
+ public:
+  using value_type = std::uint64_t;
+  using reference = value_type;
+  using const_reference = value_type;
+  using size_type = std::size_t;
+  using iterator = PackedIntIterator<packed_int_vector>;
+  using const_iterator = iterator;
+
+  static constexpr size_type block_size = 128;
+
+  explicit packed_int_vector(
+      packed_encoding encoding = packed_encoding::frame_of_reference)
+      : encoding_(encoding) {}
+
+  packed_int_vector(
+      std::initializer_list<value_type> const &items,
+      packed_encoding encoding = packed_encoding::frame_of_reference)
+      : packed_int_vector(items.begin(), items.end(), encoding) {}
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  packed_int_vector(
+      InputIt first, InputIt last,
+      packed_encoding encoding = packed_encoding::frame_of_reference)
+      : packed_int_vector(encoding) {
+    for (; first != last; ++first) push_back(*first);
+  }
+
+  packed_int_vector(const packed_int_vector &) = default;
+
+  packed_int_vector(packed_int_vector &&v) noexcept
+      : packed_int_vector(v.encoding_) {
+    swap(v);
+  }
+
+  packed_int_vector &operator=(const packed_int_vector &) = default;
+
+  packed_int_vector &operator=(packed_int_vector &&v) noexcept {
+    if (this != &v) {
+      clear();
+      swap(v);
+    }
+    return *this;
+  }
+
+  value_type at(size_type pos) const {
+    if (pos >= size()) throw std::out_of_range("Index out of range.");
+    return (*this)[pos];
+  }
+
+  value_type operator[](size_type pos) const {
+    size_type block = pos / block_size, slot = pos % block_size;
+    if (block == blocks_.size()) return tail_[slot];
+    const Block &info = blocks_.data()[block];
+    if (encoding_ == packed_encoding::frame_of_reference)
+      return info.base + Field(info, slot);
+    value_type value = info.base;
+    for (size_type i = 1; i <= slot; i++)
+      value += Field(info, i) + info.step;
+    return value;
+  }
+
+  value_type front() const {
+    if (empty()) throw std::out_of_range("Getting front() from empty vector.");
+    return (*this)[0];
+  }
+
+  value_type back() const {
+    if (empty()) throw std::out_of_range("Getting back() from empty vector\n");
+    return (*this)[size() - 1];
+  }
+
+  const_iterator begin() const noexcept { return cbegin(); }
+
+  const_iterator end() const noexcept { return cend(); }
+
+  const_iterator cbegin() const noexcept { return const_iterator(this, 0); }
+
+  const_iterator cend() const noexcept {
+    return const_iterator(this, size());
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept {
+    return blocks_.size() * block_size + tail_.size();
+  }
+
+  // Number of packed blocks; the partial block at the end is not one.
+  size_type block_count() const noexcept { return blocks_.size(); }
+
+  packed_encoding encoding() const noexcept { return encoding_; }
+
+  // Bytes owned by the vector, including its unused capacity.
+  size_type memory_usage() const noexcept {
+    return sizeof(*this) + words_.capacity() * sizeof(value_type) +
+           blocks_.capacity() * sizeof(Block);
+  }
+
+  // Writes the block_size values of a packed block to out.
+  void decode_block(size_type block, value_type *out) const {
+    if (block >= blocks_.size()) throw std::out_of_range("Index out of range.");
+    const Block &info = blocks_.data()[block];
+    bool delta = encoding_ == packed_encoding::delta;
+    simd::DispatchUnpack([&](auto kernel) {
+      decltype(kernel)::Unpack(words_.data() + info.offset, info.width,
+                               delta ? info.step : info.base, out);
+    });
+    if (delta) {
+      out[0] = info.base;
+      for (size_type i = 1; i < block_size; i++) out[i] += out[i - 1];
+    }
+  }
+
+  void push_back(value_type value) {
+    tail_.push_back(value);
+    if (tail_.full()) {
+      PackTail();
+      tail_.clear();
+    }
+  }
+
+  void clear() noexcept {
+    words_.clear();
+    blocks_.clear();
+    tail_.clear();
+  }
+
+  void shrink_to_fit() {
+    words_.shrink_to_fit();
+    blocks_.shrink_to_fit();
+  }
+
+  void swap(packed_int_vector &other) noexcept {
+    words_.swap(other.words_);
+    blocks_.swap(other.blocks_);
+    std::swap(tail_, other.tail_);
+    std::swap(encoding_, other.encoding_);
+  }
+
+ private:
+  // A block of width w takes exactly 2 * w words, since block_size is 128.
+  struct Block {
+    value_type base;
+    value_type step;
+    size_type offset;
+    unsigned width;
+  };
+
+  // Bit-packed fields of every block, followed by one zero word so that the
+  // kernels may always read the word after a field.
+  vector<value_type> words_;
+  vector<Block> blocks_;
+  static_vector<value_type, block_size> tail_;
+  packed_encoding encoding_;
+
+  value_type Field(const Block &info, size_type slot) const noexcept {
+    const value_type *words = words_.data() + info.offset;
+    size_type bit = slot * info.width, word = bit / 64, shift = bit % 64;
+    value_type value = words[word] >> shift;
+    if (shift + info.width > 64) value |= words[word + 1] << (64 - shift);
+    return info.width == 64 ? value : value & ((1ull << info.width) - 1);
+  }
+
+  void PackTail() {
+    std::array<value_type, block_size> fields;
+    Block info{tail_[0], 0, 0, 0};
+    if (encoding_ == packed_encoding::frame_of_reference) {
+      for (size_type i = 1; i < block_size; i++)
+        if (tail_[i] < info.base) info.base = tail_[i];
+      for (size_type i = 0; i < block_size; i++)
+        fields[i] = tail_[i] - info.base;
+    } else {
+      info.step = tail_[1] - tail_[0];
+      for (size_type i = 2; i < block_size; i++)
+        if (tail_[i] - tail_[i - 1] < info.step)
+          info.step = tail_[i] - tail_[i - 1];
+      fields[0] = 0;
+      for (size_type i = 1; i < block_size; i++)
+        fields[i] = tail_[i] - tail_[i - 1] - info.step;
+    }
+    value_type widest = 0;
+    for (value_type field : fields) widest |= field;
+    info.width = widest == 0 ? 0 : 64 - __builtin_clzll(widest);
+    info.offset = words_.empty() ? 0 : words_.size() - 1;
+    // Reuses the padding word as the first word of the block.
+    if (words_.empty()) words_.push_back(0);
+    words_.resize(info.offset + 2 * info.width + 1, 0);
+    value_type *words = words_.data() + info.offset;
+    for (size_type i = 0, bit = 0; i < block_size; i++, bit += info.width) {
+      if (info.width == 0) break;
+      size_type word = bit / 64, shift = bit % 64;
+      words[word] |= fields[i] << shift;
+      if (shift + info.width > 64) words[word + 1] |= fields[i] >> (64 - shift);
+    }
+    blocks_.push_back(info);
+  }
+};
+
+};  // namespace s21
+
+#endif  // S21_PACKED_INT_VECTOR_H
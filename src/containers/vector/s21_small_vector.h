@@ -0,0 +1,504 @@
+#ifndef S21_SMALL_VECTOR_H
+#define S21_SMALL_VECTOR_H
+
+#include <algorithm>
+#include <cstring>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+#include "s21_vector_iterator.h"
+
+namespace s21 {
+
+// Vector that keeps its first N elements in an inline buffer and only goes
+// to the allocator once it grows past N. Same interface as s21::vector.
+template <typename T, std::size_t N, typename Alloc = std::allocator<T>>
+class small_vector {
+  static_assert(N > 0, "small_vector needs at least one inline slot");
+
+ public:
+  using value_type = T;
+  using pointer = T *;
+  using reference = T &;
+  using const_pointer = const T *;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = VectorIterator<T, false>;
+  using const_iterator = VectorIterator<T, true>;
+
+  static constexpr size_type inline_capacity = N;
+
+  small_vector() noexcept : data_(InlineData()), size_(0), capacity_(N) {}
+
+  small_vector(size_type n) : small_vector() {
+    reserve(n);
+    resize(n);
+  }
+
+  small_vector(size_type n, const_reference value) : small_vector() {
+    reserve(n);
+    resize(n, value);
+  }
+
+  small_vector(size_type n, default_init_t) : small_vector() {
+    reserve(n);
+    resize_default_init(n);
+  }
+
+  small_vector(std::initializer_list<value_type> const &items)
+      : small_vector() {
+    insert(this->cend(), items.begin(), items.end());
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  small_vector(InputIt first, InputIt last) : small_vector() {
+    insert(this->cend(), first, last);
+  }
+
+  small_vector(const small_vector &v) : small_vector() {
+    insert(this->cend(), v.begin(), v.end());
+  }
+
+  small_vector(small_vector &&v) noexcept(kShiftsInPlace) : small_vector() {
+    StealFrom(v);
+  }
+
+  ~small_vector() { clear(); }
+
+  small_vector &operator=(small_vector &&v) noexcept(kShiftsInPlace) {
+    if (this != &v) {
+      clear();
+      StealFrom(v);
+    }
+    return *this;
+  }
+
+  small_vector &operator=(const small_vector &v) {
+    if (this != &v) {
+      clear();
+      insert(this->cend(), v.begin(), v.end());
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Index out of range.");
+    return data_[pos];
+  }
+
+  reference operator[](size_type pos) { return data_[pos]; }
+
+  const_reference front() const {
+    if (size_ == 0)
+      throw std::out_of_range("Getting front() from empty vector.");
+    return data_[0];
+  }
+
+  const_reference back() const {
+    if (size_ == 0)
+      throw std::out_of_range("Getting back() from empty vector\n");
+    return data_[size_ - 1];
+  }
+
+  T *data() { return data_; }
+
+  const T *data() const { return data_; }
+
+  const_iterator cbegin() const noexcept { return const_iterator(data_); }
+
+  const_iterator cend() const noexcept { return const_iterator(data_ + size_); }
+
+  iterator begin() const noexcept { return iterator(data_); }
+
+  iterator end() const noexcept { return iterator(data_ + size_); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return PTRDIFF_MAX / sizeof(value_type);
+  }
+
+  bool is_inline() const noexcept { return data_ == InlineData(); }
+
+  void reserve(size_type size) {
+    if (size > capacity_) ReallocateMemory(size);
+  }
+
+  size_type capacity() const noexcept { return capacity_; }
+
+  void shrink_to_fit() {
+    if (!is_inline() && capacity_ > size_) ReallocateMemory(size_);
+  }
+
+  void resize(size_type count) {
+    Resize(count, [&](pointer gap, size_type n) {
+      ConstructN(gap, n, [&](pointer p) {
+        std::allocator_traits<Alloc>::construct(alloc, p);
+      });
+    });
+  }
+
+  void resize(size_type count, const_reference value) {
+    if (count > size_)
+      insert(this->cend(), count - size_, value);
+    else
+      DestroyTail(count);
+  }
+
+  void resize_default_init(size_type count) {
+    if constexpr (std::is_trivially_default_constructible<T>::value) {
+      Resize(count, [](pointer, size_type) {});
+    } else {
+      Resize(count, [&](pointer gap, size_type n) {
+        ConstructN(gap, n, [](pointer p) { ::new (static_cast<void *>(p)) T; });
+      });
+    }
+  }
+
+  void clear() noexcept {
+    DestroyAll();
+    if (!is_inline())
+      std::allocator_traits<Alloc>::deallocate(alloc, data_, capacity_);
+    data_ = InlineData();
+    size_ = 0;
+    capacity_ = N;
+  }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    size_type index = CheckedIndex(pos);
+    InsertWithGap(index, 1, [&](pointer gap) {
+      std::allocator_traits<Alloc>::construct(alloc, gap, std::move(value));
+    });
+    return iterator(data_ + index);
+  }
+
+  iterator insert(const_iterator pos, size_type count,
+                  const_reference value) {
+    size_type index = CheckedIndex(pos);
+    value_type copy(value);
+    InsertWithGap(index, count, [&](pointer gap) {
+      ConstructN(gap, count, [&](pointer p) {
+        std::allocator_traits<Alloc>::construct(alloc, p, copy);
+      });
+    });
+    return iterator(data_ + index);
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = CheckedIndex(pos);
+    InsertRange(index, first, last,
+                typename std::iterator_traits<InputIt>::iterator_category());
+    return iterator(data_ + index);
+  }
+
+  iterator insert(const_iterator pos,
+                  std::initializer_list<value_type> items) {
+    return insert(pos, items.begin(), items.end());
+  }
+
+  template <typename Range>
+  void append_range(Range &&range) {
+    insert(this->cend(), std::begin(range), std::end(range));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index = CheckedIndex(pos);
+    if (index == size_) {
+      emplace_back(std::forward<Args>(args)...);
+    } else {
+      value_type temp(std::forward<Args>(args)...);
+      InsertWithGap(index, 1, [&](pointer gap) {
+        std::allocator_traits<Alloc>::construct(alloc, gap, std::move(temp));
+      });
+    }
+    return iterator(data_ + index);
+  }
+
+  void erase(iterator pos) {
+    if (pos < this->begin() || pos >= this->end())
+      throw std::out_of_range("Iterator out of range");
+    pointer target = std::addressof(*pos);
+    if constexpr (kRelocatable) {
+      std::allocator_traits<Alloc>::destroy(alloc, target);
+      MoveBytes(target, target + 1, data_ + size_ - (target + 1));
+      size_--;
+    } else {
+      std::move(target + 1, data_ + size_, target);
+      std::allocator_traits<Alloc>::destroy(alloc, data_ + --size_);
+    }
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type index = CheckedIndex(first);
+    size_type end = CheckedIndex(last);
+    if (end < index) throw std::out_of_range("Iterator out of range");
+    if constexpr (kRelocatable) {
+      if constexpr (!std::is_trivially_destructible<T>::value)
+        for (size_type i = index; i < end; i++)
+          std::allocator_traits<Alloc>::destroy(alloc, data_ + i);
+      MoveBytes(data_ + index, data_ + end, size_ - end);
+      size_ -= end - index;
+    } else {
+      std::move(data_ + end, data_ + size_, data_ + index);
+      DestroyTail(size_ - (end - index));
+    }
+    return iterator(data_ + index);
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      // The arguments may refer into the buffer that is about to move.
+      value_type temp(std::forward<Args>(args)...);
+      ReallocateMemory(RecommendCapacity(size_ + 1));
+      std::allocator_traits<Alloc>::construct(alloc, data_ + size_,
+                                              std::move(temp));
+    } else {
+      std::allocator_traits<Alloc>::construct(alloc, data_ + size_,
+                                              std::forward<Args>(args)...);
+    }
+    return data_[size_++];
+  }
+
+  void pop_back() {
+    if (size_ > 0)
+      std::allocator_traits<Alloc>::destroy(alloc, data_ + --size_);
+  }
+
+  void swap(small_vector &other) {
+    if (!is_inline() && !other.is_inline()) {
+      std::swap(data_, other.data_);
+      std::swap(size_, other.size_);
+      std::swap(capacity_, other.capacity_);
+      std::swap(alloc, other.alloc);
+    } else {
+      small_vector temp(std::move(other));
+      other = std::move(*this);
+      *this = std::move(temp);
+    }
+  }
+
+ private:
+  static constexpr bool kRelocatable = is_trivially_relocatable<T>::value;
+  static constexpr bool kShiftsInPlace =
+      kRelocatable || std::is_nothrow_move_constructible<T>::value;
+
+  pointer data_;
+  size_type size_;
+  size_type capacity_;
+  Alloc alloc;
+  alignas(T) unsigned char storage_[N * sizeof(T)];
+
+  pointer InlineData() noexcept { return reinterpret_cast<pointer>(storage_); }
+
+  const_pointer InlineData() const noexcept {
+    return reinterpret_cast<const_pointer>(storage_);
+  }
+
+  void DestroyAll() noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value)
+      for (size_type i = 0; i < size_; i++)
+        std::allocator_traits<Alloc>::destroy(alloc, data_ + i);
+  }
+
+  static void MoveBytes(pointer dest, const_pointer src, size_type count) {
+    if (count > 0)
+      std::memmove(static_cast<void *>(dest), static_cast<const void *>(src),
+                   count * sizeof(value_type));
+  }
+
+  size_type CheckedIndex(const_iterator pos) const {
+    if (pos < this->cbegin() || pos > this->cend())
+      throw std::out_of_range("Iterator out of range");
+    return pos - this->cbegin();
+  }
+
+  size_type RecommendCapacity(size_type required) const noexcept {
+    return std::max(capacity_ << 1, required);
+  }
+
+  // Takes over the heap buffer of v, or moves its inline elements one by one.
+  // v is left empty and inline. Relocated elements now live here, so the
+  // sources are only destroyed when they were moved from.
+  void StealFrom(small_vector &v) {
+    if (v.is_inline()) {
+      RelocateTo(InlineData(), v.data_, v.size_);
+      size_ = v.size_;
+      if constexpr (!kRelocatable) v.DestroyAll();
+    } else {
+      data_ = v.data_;
+      size_ = v.size_;
+      capacity_ = v.capacity_;
+      alloc = std::move(v.alloc);
+      v.data_ = v.InlineData();
+      v.capacity_ = N;
+    }
+    v.size_ = 0;
+  }
+
+  // Builds count elements at dest from src, memcpy for relocatable T. Moved
+  // from sources stay alive and are destroyed by the caller; relocated ones
+  // have ended up at dest and must not be.
+  void RelocateTo(pointer dest, pointer src, size_type count) {
+    if constexpr (kRelocatable) {
+      MoveBytes(dest, src, count);
+    } else {
+      ConstructN(dest, count, [&](pointer p) {
+        std::allocator_traits<Alloc>::construct(
+            alloc, p, std::move_if_noexcept(src[p - dest]));
+      });
+    }
+  }
+
+  // Moves the elements into inline storage if new_capacity fits there,
+  // otherwise into a fresh heap block. Strong guarantee.
+  void ReallocateMemory(size_type new_capacity) {
+    bool to_inline = new_capacity <= N;
+    if (to_inline) new_capacity = N;
+    pointer newdata =
+        to_inline ? InlineData()
+                  : std::allocator_traits<Alloc>::allocate(alloc, new_capacity);
+    try {
+      RelocateTo(newdata, data_, size_);
+    } catch (...) {
+      if (!to_inline)
+        std::allocator_traits<Alloc>::deallocate(alloc, newdata, new_capacity);
+      throw;
+    }
+    if constexpr (!kRelocatable) DestroyAll();
+    if (!is_inline())
+      std::allocator_traits<Alloc>::deallocate(alloc, data_, capacity_);
+    data_ = newdata;
+    capacity_ = new_capacity;
+  }
+
+  template <typename Generator>
+  void ConstructN(pointer dest, size_type count, Generator build) {
+    size_type i = 0;
+    try {
+      for (; i < count; i++) build(dest + i);
+    } catch (...) {
+      while (i-- > 0) std::allocator_traits<Alloc>::destroy(alloc, dest + i);
+      throw;
+    }
+  }
+
+  void OpenGap(size_type index, size_type count) noexcept {
+    if constexpr (kRelocatable) {
+      MoveBytes(data_ + index + count, data_ + index, size_ - index);
+    } else {
+      for (size_type i = size_; i-- > index;) {
+        std::allocator_traits<Alloc>::construct(alloc, data_ + i + count,
+                                                std::move(data_[i]));
+        std::allocator_traits<Alloc>::destroy(alloc, data_ + i);
+      }
+    }
+  }
+
+  void CloseGap(size_type index, size_type count) noexcept {
+    if constexpr (kRelocatable) {
+      MoveBytes(data_ + index, data_ + index + count, size_ - index);
+    } else {
+      for (size_type i = index; i < size_; i++) {
+        std::allocator_traits<Alloc>::construct(alloc, data_ + i,
+                                                std::move(data_[i + count]));
+        std::allocator_traits<Alloc>::destroy(alloc, data_ + i + count);
+      }
+    }
+  }
+
+  // Grows once if needed, then shifts in place. Types that may throw while
+  // moving are appended and rotated into position instead.
+  template <typename Builder>
+  void InsertWithGap(size_type index, size_type count, Builder build) {
+    if (count == 0) return;
+    if (size_ + count > capacity_) reserve(RecommendCapacity(size_ + count));
+    if constexpr (kShiftsInPlace) {
+      OpenGap(index, count);
+      try {
+        build(data_ + index);
+      } catch (...) {
+        CloseGap(index, count);
+        throw;
+      }
+      size_ += count;
+    } else {
+      size_type old_size = size_;
+      build(data_ + size_);
+      size_ += count;
+      std::rotate(data_ + index, data_ + old_size, data_ + size_);
+    }
+  }
+
+  template <typename Filler>
+  void Resize(size_type count, Filler fill) {
+    if (count <= size_) {
+      DestroyTail(count);
+    } else {
+      size_type extra = count - size_;
+      InsertWithGap(size_, extra, [&](pointer gap) { fill(gap, extra); });
+    }
+  }
+
+  void DestroyTail(size_type count) noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value)
+      for (size_type i = count; i < size_; i++)
+        std::allocator_traits<Alloc>::destroy(alloc, data_ + i);
+    size_ = count;
+  }
+
+  template <typename ForwardIt>
+  void InsertRange(size_type index, ForwardIt first, ForwardIt last,
+                   std::forward_iterator_tag) {
+    size_type count = std::distance(first, last);
+    InsertWithGap(index, count, [&](pointer gap) {
+      ForwardIt it = first;
+      ConstructN(gap, count, [&](pointer p) {
+        std::allocator_traits<Alloc>::construct(alloc, p, *it++);
+      });
+    });
+  }
+
+  template <typename InputIt>
+  void InsertRange(size_type index, InputIt first, InputIt last,
+                   std::input_iterator_tag) {
+    size_type old_size = size_;
+    for (; first != last; ++first) emplace_back(*first);
+    std::rotate(data_ + index, data_ + old_size, data_ + size_);
+  }
+};
+
+template <typename T, std::size_t N, typename Alloc, typename Predicate>
+std::size_t erase_if(small_vector<T, N, Alloc> &v, Predicate pred) {
+  auto tail = std::remove_if(v.begin(), v.end(), pred);
+  auto removed = v.end() - tail;
+  v.erase(tail, v.end());
+  return removed;
+}
+
+template <typename T, std::size_t N, typename Alloc, typename U>
+std::size_t erase(small_vector<T, N, Alloc> &v, const U &value) {
+  return erase_if(v, [&](const auto &item) { return item == value; });
+}
+
+};  // namespace s21
+
+#endif  // S21_SMALL_VECTOR_H
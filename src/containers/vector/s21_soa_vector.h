@@ -0,0 +1,353 @@
+#ifndef S21_SOA_VECTOR_H
+#define S21_SOA_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <stdexcept>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+#include "s21_span.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+// Row iterator over the columns of an soa_vector. Dereferencing yields a
+// tuple of references into every column, so rows can be read and assigned
+// field by field but not swapped as a whole.
+template <bool IsIterConst, typename... Fields>
+struct SoaIterator {
+ public:
+  using value_type = std::tuple<Fields...>;
+  using difference_type = ptrdiff_t;
+  using pointer = void;
+  using reference =
+      std::conditional_t<IsIterConst, std::tuple<const Fields &...>,
+                         std::tuple<Fields &...>>;
+  using iterator_category = std::random_access_iterator_tag;
+  using columns_type =
+      std::conditional_t<IsIterConst, std::tuple<const Fields *...>,
+                         std::tuple<Fields *...>>;
+
+  SoaIterator() noexcept : columns_(), index_(0) {}
+
+  SoaIterator(columns_type columns, std::size_t index) noexcept
+      : columns_(columns), index_(index) {}
+
+  template <bool IsOtherConst,
+            typename = std::enable_if_t<IsIterConst && !IsOtherConst>>
+  SoaIterator(const SoaIterator<IsOtherConst, Fields...> &other) noexcept
+      : columns_(other.columns_), index_(other.index_) {}
+
+  reference operator*() const {
+    return Row(std::index_sequence_for<Fields...>());
+  }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  SoaIterator &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  SoaIterator operator++(int) {
+    SoaIterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  SoaIterator &operator--() {
+    --index_;
+    return *this;
+  }
+
+  SoaIterator operator--(int) {
+    SoaIterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  SoaIterator operator+(difference_type rhs) const {
+    return SoaIterator(columns_, index_ + rhs);
+  }
+
+  friend SoaIterator operator+(difference_type lhs, const SoaIterator &rhs) {
+    return rhs + lhs;
+  }
+
+  SoaIterator operator-(difference_type rhs) const {
+    return SoaIterator(columns_, index_ - rhs);
+  }
+
+  friend difference_type operator-(const SoaIterator &lhs,
+                                   const SoaIterator &rhs) {
+    return static_cast<difference_type>(lhs.index_) -
+           static_cast<difference_type>(rhs.index_);
+  }
+
+  SoaIterator &operator+=(difference_type rhs) {
+    index_ += rhs;
+    return *this;
+  }
+
+  SoaIterator &operator-=(difference_type rhs) {
+    index_ -= rhs;
+    return *this;
+  }
+
+  friend bool operator==(const SoaIterator &lhs,
+                         const SoaIterator &rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+  }
+
+  friend bool operator!=(const SoaIterator &lhs,
+                         const SoaIterator &rhs) noexcept {
+    return lhs.index_ != rhs.index_;
+  }
+
+  friend bool operator<(const SoaIterator &lhs,
+                        const SoaIterator &rhs) noexcept {
+    return lhs.index_ < rhs.index_;
+  }
+
+  friend bool operator>(const SoaIterator &lhs,
+                        const SoaIterator &rhs) noexcept {
+    return lhs.index_ > rhs.index_;
+  }
+
+  friend bool operator<=(const SoaIterator &lhs,
+                         const SoaIterator &rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+  }
+
+  friend bool operator>=(const SoaIterator &lhs,
+                         const SoaIterator &rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+  }
+
+  std::size_t index() const noexcept { return index_; }
+
+ private:
+  template <bool, typename...>
+  friend struct SoaIterator;
+
+  template <std::size_t... I>
+  reference Row(std::index_sequence<I...>) const {
+    return reference(std::get<I>(columns_)[index_]...);
+  }
+
+  columns_type columns_;
+  std::size_t index_;
+};
+
+// Structure of arrays: every field of the row tuple is kept in its own
+// s21::vector, so scanning one field only touches that field's memory.
+// column<I>() exposes a field as a contiguous span; rows are accessed
+// through tuples of references.
+template <typename... Fields>
+class soa_vector {
+  static_assert(sizeof...(Fields) > 0, "soa_vector needs at least one field");
+  static_assert(!std::disjunction<std::is_same<Fields, bool>...>::value,
+                "bool columns are bit-packed and can not be viewed as spans; "
+                "use char or std::uint8_t instead");
+
+ public:
+  using value_type = std::tuple<Fields...>;
+  using reference = std::tuple<Fields &...>;
+  using const_reference = std::tuple<const Fields &...>;
+  using size_type = std::size_t;
+  using iterator = SoaIterator<false, Fields...>;
+  using const_iterator = SoaIterator<true, Fields...>;
+
+  template <std::size_t I>
+  using column_type = std::tuple_element_t<I, value_type>;
+
+  static constexpr size_type columns = sizeof...(Fields);
+
+  soa_vector() = default;
+
+  soa_vector(std::initializer_list<value_type> const &items) {
+    reserve(items.size());
+    for (const auto &item : items) push_back(item);
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size()) throw std::out_of_range("Index out of range.");
+    return (*this)[pos];
+  }
+
+  const_reference at(size_type pos) const {
+    if (pos >= size()) throw std::out_of_range("Index out of range.");
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) { return begin()[pos]; }
+
+  const_reference operator[](size_type pos) const { return cbegin()[pos]; }
+
+  const_reference front() const {
+    if (empty()) throw std::out_of_range("Getting front() from empty vector.");
+    return (*this)[0];
+  }
+
+  const_reference back() const {
+    if (empty()) throw std::out_of_range("Getting back() from empty vector\n");
+    return (*this)[size() - 1];
+  }
+
+  template <std::size_t I>
+  span<column_type<I>> column() noexcept {
+    auto &column = std::get<I>(columns_);
+    return span<column_type<I>>(column.data(), column.size());
+  }
+
+  template <std::size_t I>
+  span<const column_type<I>> column() const noexcept {
+    const auto &column = std::get<I>(columns_);
+    return span<const column_type<I>>(column.data(), column.size());
+  }
+
+  iterator begin() noexcept { return iterator(Columns(Indices()), 0); }
+
+  iterator end() noexcept { return iterator(Columns(Indices()), size()); }
+
+  const_iterator begin() const noexcept { return cbegin(); }
+
+  const_iterator end() const noexcept { return cend(); }
+
+  const_iterator cbegin() const noexcept {
+    return const_iterator(Columns(Indices()), 0);
+  }
+
+  const_iterator cend() const noexcept {
+    return const_iterator(Columns(Indices()), size());
+  }
+
+  bool empty() const noexcept { return size() == 0; }
+
+  size_type size() const noexcept { return std::get<0>(columns_).size(); }
+
+  size_type max_size() const noexcept {
+    return std::min({vector<Fields>().max_size()...});
+  }
+
+  void reserve(size_type size) {
+    ForEachColumn([&](auto &column) { column.reserve(size); });
+  }
+
+  size_type capacity() const noexcept {
+    return std::apply(
+        [](const auto &...column) { return std::min({column.capacity()...}); },
+        columns_);
+  }
+
+  void shrink_to_fit() {
+    ForEachColumn([](auto &column) { column.shrink_to_fit(); });
+  }
+
+  void clear() noexcept {
+    ForEachColumn([](auto &column) { column.clear(); });
+  }
+
+  void resize(size_type count) { ResizeColumns(count, Indices()); }
+
+  void push_back(const value_type &row) { AppendRow(row, Indices()); }
+
+  void push_back(value_type &&row) { AppendRow(std::move(row), Indices()); }
+
+  reference emplace_back(Fields... fields) {
+    AppendRow(std::forward_as_tuple(std::move(fields)...), Indices());
+    return (*this)[size() - 1];
+  }
+
+  void pop_back() {
+    ForEachColumn([](auto &column) { column.pop_back(); });
+  }
+
+  void erase(const_iterator pos) {
+    if (pos < cbegin() || pos >= cend())
+      throw std::out_of_range("Iterator out of range");
+    EraseRow(pos.index(), Indices());
+  }
+
+  void swap(soa_vector &other) { SwapColumns(other, Indices()); }
+
+ private:
+  using Indices = std::index_sequence_for<Fields...>;
+
+  std::tuple<vector<Fields>...> columns_;
+
+  template <std::size_t... I>
+  std::tuple<Fields *...> Columns(std::index_sequence<I...>) noexcept {
+    return std::tuple<Fields *...>(std::get<I>(columns_).data()...);
+  }
+
+  template <std::size_t... I>
+  std::tuple<const Fields *...> Columns(
+      std::index_sequence<I...>) const noexcept {
+    return std::tuple<const Fields *...>(std::get<I>(columns_).data()...);
+  }
+
+  template <typename Function>
+  void ForEachColumn(Function f) {
+    std::apply([&](auto &...column) { (f(column), ...); }, columns_);
+  }
+
+  template <std::size_t... I>
+  void SwapColumns(soa_vector &other, std::index_sequence<I...>) {
+    (std::get<I>(columns_).swap(std::get<I>(other.columns_)), ...);
+  }
+
+  // Resizes one column at a time; if one of them throws, the columns that
+  // already grew are cut back to the old size.
+  template <std::size_t... I>
+  void ResizeColumns(size_type count, std::index_sequence<I...>) {
+    size_type old_size = size();
+    size_type resized = 0;
+    try {
+      ((std::get<I>(columns_).resize(count), resized++), ...);
+    } catch (...) {
+      ((I < resized ? std::get<I>(columns_).resize(old_size) : void()), ...);
+      throw;
+    }
+  }
+
+  // Erases the row one column at a time. Only a throwing move can fail
+  // there, and it leaves that column's size unchanged, so the columns not
+  // yet erased drop their last element instead: every column keeps the same
+  // size, but the rows from index on are unspecified.
+  template <std::size_t... I>
+  void EraseRow(size_type index, std::index_sequence<I...>) {
+    size_type erased = 0;
+    try {
+      ((std::get<I>(columns_).erase(std::get<I>(columns_).begin() + index),
+        erased++),
+       ...);
+    } catch (...) {
+      ((I < erased ? void() : std::get<I>(columns_).pop_back()), ...);
+      throw;
+    }
+  }
+
+  // Appends the fields one column at a time; if one of them throws, the
+  // columns that already grew are popped so all of them keep the same size.
+  template <typename Row, std::size_t... I>
+  void AppendRow(Row &&row, std::index_sequence<I...>) {
+    size_type pushed = 0;
+    try {
+      ((std::get<I>(columns_).push_back(std::get<I>(std::forward<Row>(row))),
+        pushed++),
+       ...);
+    } catch (...) {
+      ((I < pushed ? std::get<I>(columns_).pop_back() : void()), ...);
+      throw;
+    }
+  }
+};
+
+};  // namespace s21
+
+#endif  // S21_SOA_VECTOR_H
@@ -0,0 +1,64 @@
+#ifndef S21_SPAN_H
+#define S21_SPAN_H
+
+#include <cstddef>
+#include <stdexcept>
+#include <type_traits>
+
+namespace s21 {
+
+// Non-owning view of count contiguous elements, a minimal stand-in for the
+// C++20 std::span. Iterators are plain pointers.
+template <typename T>
+class span {
+ public:
+  using element_type = T;
+  using value_type = std::remove_cv_t<T>;
+  using pointer = T *;
+  using reference = T &;
+  using size_type = std::size_t;
+  using iterator = T *;
+
+  constexpr span() noexcept : data_(nullptr), size_(0) {}
+
+  constexpr span(pointer data, size_type size) noexcept
+      : data_(data), size_(size) {}
+
+  template <typename U,
+            typename = std::enable_if_t<std::is_convertible<U *, T *>::value>>
+  constexpr span(const span<U> &other) noexcept
+      : data_(other.data()), size_(other.size()) {}
+
+  constexpr pointer data() const noexcept { return data_; }
+
+  constexpr size_type size() const noexcept { return size_; }
+
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr reference operator[](size_type pos) const { return data_[pos]; }
+
+  reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Index out of range.");
+    return data_[pos];
+  }
+
+  constexpr reference front() const { return data_[0]; }
+
+  constexpr reference back() const { return data_[size_ - 1]; }
+
+  constexpr iterator begin() const noexcept { return data_; }
+
+  constexpr iterator end() const noexcept { return data_ + size_; }
+
+  constexpr span subspan(size_type offset, size_type count) const {
+    return span(data_ + offset, count);
+  }
+
+ private:
+  pointer data_;
+  size_type size_;
+};
+
+};  // namespace s21
+
+#endif  // S21_SPAN_H
@@ -0,0 +1,424 @@
+#ifndef S21_STATIC_VECTOR_H
+#define S21_STATIC_VECTOR_H
+
+#include <algorithm>
+#include <cstddef>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <new>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+#include "s21_vector.h"
+#include "s21_vector_iterator.h"
+
+namespace s21 {
+
+// Inline element storage of a static_vector. Trivial types are kept in a
+// plain array, so the defaulted copy and move are trivial and the vector can
+// be built in constant expressions; the array is value-initialized because
+// C++17 constexpr constructors must initialize every member.
+template <typename T, std::size_t N, bool = std::is_trivial<T>::value,
+          bool = std::is_trivially_copyable<T>::value>
+class StaticVectorStorage {
+ protected:
+  constexpr StaticVectorStorage() noexcept : items_{}, size_(0) {}
+
+  constexpr T *Data() noexcept { return items_; }
+
+  constexpr const T *Data() const noexcept { return items_; }
+
+  template <typename... Args>
+  constexpr void Construct(std::size_t pos, Args &&...args) {
+    items_[pos] = T(std::forward<Args>(args)...);
+  }
+
+  constexpr void ConstructDefault(std::size_t) noexcept {}
+
+  constexpr void Destroy(std::size_t) noexcept {}
+
+  T items_[N];
+  std::size_t size_;
+};
+
+// Other types live in raw bytes and are constructed in place. A trivially
+// copyable T that is not trivial, e.g. one with its own default constructor,
+// cannot sit in a value-initialized array, but copying the bytes is still
+// right for it: the implicit copy, move and destructor are kept, so the
+// vector stays trivially copyable.
+template <typename T, std::size_t N>
+class StaticVectorStorage<T, N, false, true> {
+ protected:
+  StaticVectorStorage() noexcept : size_(0) {}
+
+  T *Data() noexcept { return std::launder(reinterpret_cast<T *>(bytes_)); }
+
+  const T *Data() const noexcept {
+    return std::launder(reinterpret_cast<const T *>(bytes_));
+  }
+
+  template <typename... Args>
+  void Construct(std::size_t pos, Args &&...args) {
+    ::new (static_cast<void *>(Data() + pos)) T(std::forward<Args>(args)...);
+  }
+
+  void ConstructDefault(std::size_t pos) {
+    ::new (static_cast<void *>(Data() + pos)) T;
+  }
+
+  void Destroy(std::size_t pos) noexcept { std::destroy_at(Data() + pos); }
+
+  alignas(T) unsigned char bytes_[N * sizeof(T)];
+  std::size_t size_;
+};
+
+// Everything else needs its elements copied, moved and destroyed one by one.
+// A moved from vector is left empty, like s21::vector.
+template <typename T, std::size_t N>
+class StaticVectorStorage<T, N, false, false>
+    : public StaticVectorStorage<T, N, false, true> {
+  using Bytes = StaticVectorStorage<T, N, false, true>;
+
+ protected:
+  using Bytes::Construct;
+  using Bytes::Data;
+  using Bytes::Destroy;
+  using Bytes::size_;
+
+  StaticVectorStorage() noexcept = default;
+
+  StaticVectorStorage(const StaticVectorStorage &other) : Bytes() {
+    CopyFrom(other.Data(), other.size_);
+  }
+
+  StaticVectorStorage(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value)
+      : Bytes() {
+    CopyFrom(std::make_move_iterator(other.Data()), other.size_);
+    other.Clear();
+  }
+
+  ~StaticVectorStorage() { Clear(); }
+
+  StaticVectorStorage &operator=(const StaticVectorStorage &other) {
+    if (this != &other) {
+      Clear();
+      CopyFrom(other.Data(), other.size_);
+    }
+    return *this;
+  }
+
+  StaticVectorStorage &operator=(StaticVectorStorage &&other) noexcept(
+      std::is_nothrow_move_constructible<T>::value) {
+    if (this != &other) {
+      Clear();
+      CopyFrom(std::make_move_iterator(other.Data()), other.size_);
+      other.Clear();
+    }
+    return *this;
+  }
+
+ private:
+  void Clear() noexcept {
+    for (; size_ > 0; size_--) Destroy(size_ - 1);
+  }
+
+  // Builds count elements from src into an empty storage. If one of them
+  // throws, the ones already built are destroyed, since a constructor that
+  // throws does not run the destructor.
+  template <typename It>
+  void CopyFrom(It src, std::size_t count) {
+    try {
+      for (; size_ < count; ++src) {
+        Construct(size_, *src);
+        size_++;
+      }
+    } catch (...) {
+      Clear();
+      throw;
+    }
+  }
+};
+
+// Vector with room for N elements inside the object itself; it never
+// allocates. The interface is that of s21::vector, but growing past N throws
+// std::length_error instead of reallocating, and iterators stay valid until
+// the element they point at is moved. It is trivially copyable whenever T
+// is, and for trivial T its element access, push_back and pop_back are
+// usable in constant expressions.
+template <typename T, std::size_t N>
+class static_vector : private StaticVectorStorage<T, N> {
+  static_assert(N > 0, "static_vector needs at least one slot");
+
+  using Storage = StaticVectorStorage<T, N>;
+  using Storage::Construct;
+  using Storage::ConstructDefault;
+  using Storage::Data;
+  using Storage::Destroy;
+  using Storage::size_;
+
+ public:
+  using value_type = T;
+  using pointer = T *;
+  using reference = T &;
+  using const_pointer = const T *;
+  using const_reference = const T &;
+  using size_type = std::size_t;
+  using iterator = VectorIterator<T, false>;
+  using const_iterator = VectorIterator<T, true>;
+
+  static constexpr size_type static_capacity = N;
+
+  static_vector() = default;
+
+  static_vector(size_type n) : static_vector() { resize(n); }
+
+  static_vector(size_type n, const_reference value) : static_vector() {
+    resize(n, value);
+  }
+
+  static_vector(size_type n, default_init_t) : static_vector() {
+    resize_default_init(n);
+  }
+
+  static_vector(std::initializer_list<value_type> const &items)
+      : static_vector() {
+    insert(this->cend(), items.begin(), items.end());
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  static_vector(InputIt first, InputIt last) : static_vector() {
+    insert(this->cend(), first, last);
+  }
+
+  constexpr reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Index out of range.");
+    return Data()[pos];
+  }
+
+  constexpr const_reference at(size_type pos) const {
+    if (pos >= size_) throw std::out_of_range("Index out of range.");
+    return Data()[pos];
+  }
+
+  constexpr reference operator[](size_type pos) { return Data()[pos]; }
+
+  constexpr const_reference operator[](size_type pos) const {
+    return Data()[pos];
+  }
+
+  constexpr const_reference front() const {
+    if (size_ == 0)
+      throw std::out_of_range("Getting front() from empty vector.");
+    return Data()[0];
+  }
+
+  constexpr const_reference back() const {
+    if (size_ == 0)
+      throw std::out_of_range("Getting back() from empty vector\n");
+    return Data()[size_ - 1];
+  }
+
+  constexpr T *data() noexcept { return Data(); }
+
+  constexpr const T *data() const noexcept { return Data(); }
+
+  const_iterator cbegin() const noexcept { return const_iterator(Begin()); }
+
+  const_iterator cend() const noexcept {
+    return const_iterator(Begin() + size_);
+  }
+
+  iterator begin() const noexcept { return iterator(Begin()); }
+
+  iterator end() const noexcept { return iterator(Begin() + size_); }
+
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr bool full() const noexcept { return size_ == N; }
+
+  constexpr size_type size() const noexcept { return size_; }
+
+  constexpr size_type max_size() const noexcept { return N; }
+
+  // Only checks that size fits; the storage is always there.
+  void reserve(size_type size) { CheckRoom(size, 0); }
+
+  constexpr size_type capacity() const noexcept { return N; }
+
+  void shrink_to_fit() noexcept {}
+
+  void resize(size_type count) {
+    Resize(count, [&] { Construct(size_); });
+  }
+
+  void resize(size_type count, const_reference value) {
+    if (count > size_)
+      insert(this->cend(), count - size_, value);
+    else
+      DestroyTail(count);
+  }
+
+  void resize_default_init(size_type count) {
+    Resize(count, [&] { ConstructDefault(size_); });
+  }
+
+  constexpr void clear() noexcept { DestroyTail(0); }
+
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    return emplace(pos, std::move(value));
+  }
+
+  iterator insert(const_iterator pos, size_type count,
+                  const_reference value) {
+    size_type index = CheckedIndex(pos);
+    CheckRoom(size_, count);
+    value_type copy(value);
+    return AppendAndRotate(index, [&] {
+      for (size_type i = 0; i < count; i++) emplace_back(copy);
+    });
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = CheckedIndex(pos);
+    if constexpr (std::is_convertible<
+                      typename std::iterator_traits<InputIt>::iterator_category,
+                      std::forward_iterator_tag>::value)
+      CheckRoom(size_, std::distance(first, last));
+    return AppendAndRotate(index, [&] {
+      for (; first != last; ++first) emplace_back(*first);
+    });
+  }
+
+  iterator insert(const_iterator pos,
+                  std::initializer_list<value_type> items) {
+    return insert(pos, items.begin(), items.end());
+  }
+
+  template <typename Range>
+  void append_range(Range &&range) {
+    insert(this->cend(), std::begin(range), std::end(range));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index = CheckedIndex(pos);
+    return AppendAndRotate(
+        index, [&] { emplace_back(std::forward<Args>(args)...); });
+  }
+
+  void erase(iterator pos) {
+    if (pos < this->begin() || pos >= this->end())
+      throw std::out_of_range("Iterator out of range");
+    erase(pos, pos + 1);
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type index = CheckedIndex(first);
+    size_type end = CheckedIndex(last);
+    if (end < index) throw std::out_of_range("Iterator out of range");
+    std::move(Data() + end, Data() + size_, Data() + index);
+    DestroyTail(size_ - (end - index));
+    return iterator(Data() + index);
+  }
+
+  constexpr void push_back(const_reference value) { emplace_back(value); }
+
+  constexpr void push_back(value_type &&value) {
+    emplace_back(std::move(value));
+  }
+
+  template <typename... Args>
+  constexpr reference emplace_back(Args &&...args) {
+    CheckRoom(size_, 1);
+    Construct(size_, std::forward<Args>(args)...);
+    return Data()[size_++];
+  }
+
+  constexpr void pop_back() {
+    if (size_ > 0) Destroy(--size_);
+  }
+
+  void swap(static_vector &other) {
+    if (this == &other) return;
+    static_vector &longer = size_ < other.size_ ? other : *this;
+    static_vector &shorter = size_ < other.size_ ? *this : other;
+    std::swap_ranges(shorter.Data(), shorter.Data() + shorter.size_,
+                     longer.Data());
+    size_type common = shorter.size_;
+    for (size_type i = common; i < longer.size_; i++)
+      shorter.emplace_back(std::move(longer.Data()[i]));
+    longer.DestroyTail(common);
+  }
+
+ private:
+  // begin() is const but hands out mutable iterators, as in s21::vector.
+  pointer Begin() const noexcept { return const_cast<pointer>(Data()); }
+
+  static constexpr void CheckRoom(size_type size, size_type count) {
+    if (size > N || count > N - size)
+      throw std::length_error("Capacity is too large.");
+  }
+
+  size_type CheckedIndex(const_iterator pos) const {
+    if (pos < this->cbegin() || pos > this->cend())
+      throw std::out_of_range("Iterator out of range");
+    return pos - this->cbegin();
+  }
+
+  constexpr void DestroyTail(size_type count) noexcept {
+    while (size_ > count) Destroy(--size_);
+  }
+
+  template <typename Build>
+  void Resize(size_type count, Build build) {
+    if (count > size_) {
+      CheckRoom(count, 0);
+      while (size_ < count) {
+        build();
+        size_++;
+      }
+    } else {
+      DestroyTail(count);
+    }
+  }
+
+  // Builds the new elements at the end and rotates them into place. If
+  // building throws, the elements added so far are removed again.
+  template <typename Append>
+  iterator AppendAndRotate(size_type index, Append append) {
+    size_type old_size = size_;
+    try {
+      append();
+    } catch (...) {
+      DestroyTail(old_size);
+      throw;
+    }
+    std::rotate(Data() + index, Data() + old_size, Data() + size_);
+    return iterator(Data() + index);
+  }
+};
+
+template <typename T, std::size_t N, typename Predicate>
+std::size_t erase_if(static_vector<T, N> &v, Predicate pred) {
+  auto tail = std::remove_if(v.begin(), v.end(), pred);
+  auto removed = v.end() - tail;
+  v.erase(tail, v.end());
+  return removed;
+}
+
+template <typename T, std::size_t N, typename U>
+std::size_t erase(static_vector<T, N> &v, const U &value) {
+  return erase_if(v, [&](const auto &item) { return item == value; });
+}
+
+};  // namespace s21
+
+#endif  // S21_STATIC_VECTOR_H
@@ -1,15 +1,44 @@
 #ifndef S21_VECTOR_H
 #define S21_VECTOR_H
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <initializer_list>
+#include <iterator>
 #include <memory>
+#include <new>
 #include <stdexcept>
+#include <type_traits>
+#include <utility>
 
+#include "../allocator/s21_aligned_allocator.h"
+#include "s21_growth_policy.h"
 #include "s21_vector_iterator.h"
 
 namespace s21 {
 
-template <typename T, typename Alloc = std::allocator<T>>
+// Types whose objects can be moved to a new address with memcpy, without
+// running the move constructor and destructor. Specialize for types that are
+// not trivially copyable but still safe to move bytewise.
+template <typename T>
+struct is_trivially_relocatable : std::is_trivially_copyable<T> {};
+
+// Tag for the sizing constructor that default-initializes its elements, so
+// trivial types are left uninitialized instead of zero-filled.
+struct default_init_t {
+  explicit default_init_t() = default;
+};
+
+inline constexpr default_init_t default_init{};
+
+template <typename It>
+using RequireInputIterator = std::enable_if_t<std::is_convertible<
+    typename std::iterator_traits<It>::iterator_category,
+    std::input_iterator_tag>::value>;
+
+template <typename T, typename Alloc = std::allocator<T>,
+          typename Growth = growth::doubling>
 class vector {
  public:
   using value_type = T;
@@ -21,12 +50,24 @@ class vector {
   using iterator = VectorIterator<T, false>;
   using const_iterator = VectorIterator<T, true>;
 
+  // Alignment guaranteed for data() whenever it is not null.
+  static constexpr size_type data_alignment = allocator_alignment<Alloc>::value;
+
   vector() : data_(nullptr), size_(0), capacity_(0) {}
 
-  vector(size_type n) : size_(n), capacity_(n) {
-    AllocateMemory();
-    for (auto it = this->begin(); it != this->end(); it++)
-      std::allocator_traits<Alloc>::construct(alloc, std::addressof(*it), T());
+  vector(size_type n) : vector() {
+    reserve(n);
+    resize(n);
+  }
+
+  vector(size_type n, const_reference value) : vector() {
+    reserve(n);
+    resize(n, value);
+  }
+
+  vector(size_type n, default_init_t) : vector() {
+    reserve(n);
+    resize_default_init(n);
   }
 
   vector(std::initializer_list<value_type> const &items)
@@ -38,6 +79,11 @@ class vector {
                                               std::move_if_noexcept(*it));
   }
 
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  vector(InputIt first, InputIt last) : vector() {
+    insert(this->cend(), first, last);
+  }
+
   vector(const vector &v) : size_(v.size_), capacity_(v.capacity_) {
     AllocateMemory();
     std::uninitialized_copy(v.begin(), v.end(), data_);
@@ -90,6 +136,8 @@ class vector {
 
   T *data() { return data_; }
 
+  const T *data() const { return data_; }
+
   const_iterator cbegin() const noexcept { return const_iterator(data_); }
 
   const_iterator cend() const noexcept { return const_iterator(data_ + size_); }
@@ -107,44 +155,39 @@ class vector {
   }
 
   void reserve(size_type size) {
-    if (size > capacity_) {
-      pointer newdata = std::allocator_traits<Alloc>::allocate(alloc, size);
-      size_type i = 0;
-      try {
-        for (; i < size_; i++)
-          std::allocator_traits<Alloc>::construct(
-              alloc, newdata + i, std::move_if_noexcept(data_[i]));
-      } catch (...) {
-        for (size_type j = 0; j < i; j++)
-          std::allocator_traits<Alloc>::destroy(alloc, newdata + j);
-        std::allocator_traits<Alloc>::deallocate(alloc, newdata, size);
-        throw;
-      }
-      DeallocateMemory();
-      data_ = newdata;
-      capacity_ = size;
-    }
+    if (size > capacity_) ReallocateMemory(size);
   }
 
   size_type capacity() const noexcept { return capacity_; }
 
   void shrink_to_fit() {
-    if (capacity_ > size_) {
-      pointer newdata = std::allocator_traits<Alloc>::allocate(alloc, size_);
-      size_type i = 0;
-      try {
-        for (; i < size_; i++)
-          std::allocator_traits<Alloc>::construct(
-              alloc, newdata + i, std::move_if_noexcept(data_[i]));
-      } catch (...) {
-        for (size_type j = 0; j < i; j++)
-          std::allocator_traits<Alloc>::destroy(alloc, newdata + j);
-        std::allocator_traits<Alloc>::deallocate(alloc, newdata, size_);
-        throw;
-      }
-      DeallocateMemory();
-      data_ = newdata;
-      capacity_ = size_;
+    if (capacity_ > size_) ReallocateMemory(size_);
+  }
+
+  void resize(size_type count) {
+    Resize(count, [&](pointer gap, size_type n) {
+      ConstructN(gap, n, [&](pointer p) {
+        std::allocator_traits<Alloc>::construct(alloc, p);
+      });
+    });
+  }
+
+  void resize(size_type count, const_reference value) {
+    if (count > size_)
+      insert(this->cend(), count - size_, value);
+    else
+      DestroyTail(count);
+  }
+
+  // Same as resize(count), but new elements are default-initialized: for
+  // trivial types this only adjusts the size and leaves the memory as is.
+  void resize_default_init(size_type count) {
+    if constexpr (std::is_trivially_default_constructible<T>::value) {
+      Resize(count, [](pointer, size_type) {});
+    } else {
+      Resize(count, [&](pointer gap, size_type n) {
+        ConstructN(gap, n, [](pointer p) { ::new (static_cast<void *>(p)) T; });
+      });
     }
   }
 
@@ -154,71 +197,119 @@ class vector {
     data_ = nullptr;
   }
 
-  iterator insert(iterator pos, const_reference value) {
-    if (pos < this->begin() || pos > this->end())
-      throw std::out_of_range("Iterator out of range");
-    size_type new_capacity = capacity_;
-    if (size_ + 1 >= capacity_) new_capacity = capacity_ << 1;
-    pointer newdata =
-        std::allocator_traits<Alloc>::allocate(alloc, new_capacity);
-    size_type z = 0;
-    iterator it;
-    try {
-      for (size_type i = 0; i < size_; i++) {
-        if (pos == iterator(data_ + i)) {
-          it = iterator(newdata + z);
-          std::allocator_traits<Alloc>::construct(alloc, newdata + z++,
-                                                  std::move_if_noexcept(value));
-        }
-        std::allocator_traits<Alloc>::construct(
-            alloc, newdata + z++, std::move_if_noexcept(data_[i]));
+  iterator insert(const_iterator pos, const_reference value) {
+    return emplace(pos, value);
+  }
+
+  iterator insert(const_iterator pos, value_type &&value) {
+    size_type index = CheckedIndex(pos);
+    InsertWithGap(index, 1, [&](pointer gap) {
+      std::allocator_traits<Alloc>::construct(alloc, gap, std::move(value));
+    });
+    return iterator(data_ + index);
+  }
+
+  iterator insert(const_iterator pos, size_type count,
+                  const_reference value) {
+    size_type index = CheckedIndex(pos);
+    value_type copy(value);
+    InsertWithGap(index, count, [&](pointer gap) {
+      ConstructN(gap, count, [&](pointer p) {
+        std::allocator_traits<Alloc>::construct(alloc, p, copy);
+      });
+    });
+    return iterator(data_ + index);
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = CheckedIndex(pos);
+    InsertRange(index, first, last,
+                typename std::iterator_traits<InputIt>::iterator_category());
+    return iterator(data_ + index);
+  }
+
+  iterator insert(const_iterator pos,
+                  std::initializer_list<value_type> items) {
+    return insert(pos, items.begin(), items.end());
+  }
+
+  template <typename Range>
+  void append_range(Range &&range) {
+    insert(this->cend(), std::begin(range), std::end(range));
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    size_type index = CheckedIndex(pos);
+    if (size_ == capacity_) {
+      GrowAndEmplace(index, std::forward<Args>(args)...);
+    } else if (index == size_ || !kShiftsInPlace) {
+      std::allocator_traits<Alloc>::construct(alloc, data_ + size_,
+                                              std::forward<Args>(args)...);
+      size_++;
+      if constexpr (!kShiftsInPlace) RotateTail(index, 1);
+    } else {
+      value_type temp(std::forward<Args>(args)...);
+      OpenGap(index, 1);
+      try {
+        std::allocator_traits<Alloc>::construct(alloc, data_ + index,
+                                                std::move(temp));
+      } catch (...) {
+        CloseGap(index, 1);
+        throw;
       }
-      if (pos == this->end())
-        std::allocator_traits<Alloc>::construct(alloc, newdata + z++,
-                                                std::move_if_noexcept(value));
-    } catch (...) {
-      for (size_type i = 0; i < z; i++)
-        std::allocator_traits<Alloc>::destroy(alloc, newdata + i);
-      std::allocator_traits<Alloc>::deallocate(alloc, newdata, new_capacity);
-      throw;
+      size_++;
     }
-    DeallocateMemory();
-    data_ = newdata;
-    capacity_ = new_capacity;
-    size_++;
-    return it;
+    return iterator(data_ + index);
   }
 
   void erase(iterator pos) {
     if (pos < this->begin() || pos >= this->end())
       throw std::out_of_range("Iterator out of range");
-    pointer newdata = std::allocator_traits<Alloc>::allocate(alloc, capacity_);
-    size_type z = 0;
-    try {
-      for (size_type i = 0; i < size_; i++) {
-        if (pos != iterator(data_ + i))
-          std::allocator_traits<Alloc>::construct(
-              alloc, newdata + z++, std::move_if_noexcept(data_[i]));
-      }
-    } catch (...) {
-      for (size_type i = 0; i < z; i++)
-        std::allocator_traits<Alloc>::destroy(alloc, newdata + i);
-      std::allocator_traits<Alloc>::deallocate(alloc, newdata, capacity_);
-      throw;
+    pointer target = std::addressof(*pos);
+    if constexpr (kRelocatable) {
+      std::allocator_traits<Alloc>::destroy(alloc, target);
+      MoveBytes(target, target + 1, data_ + size_ - (target + 1));
+      size_--;
+    } else {
+      std::move(target + 1, data_ + size_, target);
+      std::allocator_traits<Alloc>::destroy(alloc, data_ + --size_);
     }
-    DeallocateMemory();
-    data_ = newdata;
-    size_--;
   }
 
-  void push_back(const_reference value) {
-    if (capacity_ == 0) {
-      capacity_ = 1;
-      AllocateMemory();
+  // Removes [first, last) with a single shift of the tail.
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type index = CheckedIndex(first);
+    size_type end = CheckedIndex(last);
+    if (end < index) throw std::out_of_range("Iterator out of range");
+    if constexpr (kRelocatable) {
+      if constexpr (!std::is_trivially_destructible<T>::value)
+        for (size_type i = index; i < end; i++)
+          std::allocator_traits<Alloc>::destroy(alloc, data_ + i);
+      MoveBytes(data_ + index, data_ + end, size_ - end);
+      size_ -= end - index;
+    } else {
+      std::move(data_ + end, data_ + size_, data_ + index);
+      DestroyTail(size_ - (end - index));
+    }
+    return iterator(data_ + index);
+  }
+
+  void push_back(const_reference value) { emplace_back(value); }
+
+  void push_back(value_type &&value) { emplace_back(std::move(value)); }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    if (size_ == capacity_) {
+      GrowAndEmplace(size_, std::forward<Args>(args)...);
+    } else {
+      std::allocator_traits<Alloc>::construct(alloc, data_ + size_,
+                                              std::forward<Args>(args)...);
+      size_++;
     }
-    if (size_ == capacity_) reserve(capacity_ << 1);
-    std::allocator_traits<Alloc>::construct(alloc, data_ + size_++,
-                                            std::move_if_noexcept(value));
+    return data_[size_ - 1];
   }
 
   void pop_back() {
@@ -233,23 +324,330 @@ class vector {
   }
 
  private:
+  static constexpr bool kRelocatable = is_trivially_relocatable<T>::value;
+  static constexpr bool kShiftsInPlace =
+      kRelocatable || std::is_nothrow_move_constructible<T>::value;
+  // With the default allocator the buffer of a relocatable T can live in
+  // malloc memory and grow through realloc, which extends the block in place
+  // when possible and remaps large (mmap-backed) blocks instead of copying.
+  static constexpr bool kUsesRealloc =
+      kRelocatable && std::is_same<Alloc, std::allocator<T>>::value &&
+      alignof(T) <= alignof(std::max_align_t);
+
   pointer data_;
   size_type size_;
   size_type capacity_;
   Alloc alloc;
 
-  void AllocateMemory() {
-    data_ = std::allocator_traits<Alloc>::allocate(alloc, capacity_);
+  void AllocateMemory() { data_ = AllocateBuffer(capacity_); }
+
+  pointer AllocateBuffer(size_type n) {
+    if constexpr (kUsesRealloc) {
+      if (n > max_size()) throw std::length_error("Capacity is too large.");
+      if (n == 0) return nullptr;
+      pointer p = static_cast<pointer>(std::malloc(n * sizeof(value_type)));
+      if (p == nullptr) throw std::bad_alloc();
+      return p;
+    } else {
+      return std::allocator_traits<Alloc>::allocate(alloc, n);
+    }
+  }
+
+  void DeallocateBuffer(pointer p, size_type n) {
+    if constexpr (kUsesRealloc)
+      std::free(static_cast<void *>(p));
+    else
+      std::allocator_traits<Alloc>::deallocate(alloc, p, n);
   }
 
   void DeallocateMemory() {
-    for (size_type i = 0; i < size_; i++)
-      std::allocator_traits<Alloc>::destroy(alloc, data_ + i);
-    std::allocator_traits<Alloc>::deallocate(alloc, data_, capacity_);
+    if constexpr (!std::is_trivially_destructible<T>::value)
+      for (size_type i = 0; i < size_; i++)
+        std::allocator_traits<Alloc>::destroy(alloc, data_ + i);
+    DeallocateBuffer(data_, capacity_);
     data_ = nullptr;
   }
+
+  // Releases the buffer after its elements were relocated bytewise, so no
+  // destructor may run on the old copies.
+  void DeallocateRelocated() {
+    DeallocateBuffer(data_, capacity_);
+    data_ = nullptr;
+  }
+
+  static void CopyBytes(pointer dest, const_pointer src, size_type count) {
+    if (count > 0)
+      std::memcpy(static_cast<void *>(dest), static_cast<const void *>(src),
+                  count * sizeof(value_type));
+  }
+
+  static void MoveBytes(pointer dest, const_pointer src, size_type count) {
+    if (count > 0)
+      std::memmove(static_cast<void *>(dest), static_cast<const void *>(src),
+                   count * sizeof(value_type));
+  }
+
+  size_type CheckedIndex(const_iterator pos) const {
+    if (pos < this->cbegin() || pos > this->cend())
+      throw std::out_of_range("Iterator out of range");
+    return pos - this->cbegin();
+  }
+
+  size_type RecommendCapacity(size_type required) const noexcept {
+    return std::max(Growth::next_capacity(capacity_, required), required);
+  }
+
+  void ReallocateMemory(size_type new_capacity) {
+    if constexpr (kUsesRealloc) {
+      if (new_capacity > max_size())
+        throw std::length_error("Capacity is too large.");
+      if (new_capacity == 0) {
+        std::free(static_cast<void *>(data_));
+        data_ = nullptr;
+      } else {
+        void *grown = std::realloc(static_cast<void *>(data_),
+                                    new_capacity * sizeof(value_type));
+        if (grown == nullptr) throw std::bad_alloc();
+        data_ = static_cast<pointer>(grown);
+      }
+      capacity_ = new_capacity;
+      return;
+    }
+    pointer newdata = AllocateBuffer(new_capacity);
+    if constexpr (kRelocatable) {
+      CopyBytes(newdata, data_, size_);
+      DeallocateRelocated();
+    } else {
+      try {
+        MoveToUninitialized(data_, data_ + size_, newdata);
+      } catch (...) {
+        DeallocateBuffer(newdata, new_capacity);
+        throw;
+      }
+      DeallocateMemory();
+    }
+    data_ = newdata;
+    capacity_ = new_capacity;
+  }
+
+  // Builds [first, last) in raw storage at dest, moving when the move can not
+  // throw. On failure everything built so far is destroyed.
+  pointer MoveToUninitialized(pointer first, pointer last, pointer dest) {
+    pointer current = dest;
+    try {
+      for (; first != last; ++first, ++current)
+        std::allocator_traits<Alloc>::construct(alloc, current,
+                                                std::move_if_noexcept(*first));
+    } catch (...) {
+      for (; dest != current; ++dest)
+        std::allocator_traits<Alloc>::destroy(alloc, dest);
+      throw;
+    }
+    return current;
+  }
+
+  // Moves the tail starting at index count slots to the right, leaving raw
+  // storage behind. Only used when kShiftsInPlace and capacity allows.
+  void OpenGap(size_type index, size_type count) noexcept {
+    if constexpr (kRelocatable) {
+      MoveBytes(data_ + index + count, data_ + index, size_ - index);
+    } else {
+      for (size_type i = size_; i-- > index;) {
+        std::allocator_traits<Alloc>::construct(alloc, data_ + i + count,
+                                                std::move(data_[i]));
+        std::allocator_traits<Alloc>::destroy(alloc, data_ + i);
+      }
+    }
+  }
+
+  // Inverse of OpenGap, used to restore the layout when filling a gap throws.
+  void CloseGap(size_type index, size_type count) noexcept {
+    if constexpr (kRelocatable) {
+      MoveBytes(data_ + index, data_ + index + count, size_ - index);
+    } else {
+      for (size_type i = index; i < size_; i++) {
+        std::allocator_traits<Alloc>::construct(alloc, data_ + i,
+                                                std::move(data_[i + count]));
+        std::allocator_traits<Alloc>::destroy(alloc, data_ + i + count);
+      }
+    }
+  }
+
+  // Calls build(p) for count consecutive raw slots, destroying the built
+  // prefix if one of the calls throws.
+  template <typename Generator>
+  void ConstructN(pointer dest, size_type count, Generator build) {
+    size_type i = 0;
+    try {
+      for (; i < count; i++) build(dest + i);
+    } catch (...) {
+      while (i-- > 0) std::allocator_traits<Alloc>::destroy(alloc, dest + i);
+      throw;
+    }
+  }
+
+  // Makes room for count elements at index with at most one reallocation.
+  // build must fill the whole gap or clean up after itself and throw.
+  // Appending never moves elements, so spare capacity is used for any T; a
+  // T that can not be shifted in place is appended and rotated into place.
+  template <typename Builder>
+  void InsertWithGap(size_type index, size_type count, Builder build) {
+    if (count == 0) return;
+    if (size_ + count > capacity_) {
+      ReallocateWithGap(index, count, build);
+    } else if (index == size_ || !kShiftsInPlace) {
+      build(data_ + size_);
+      size_ += count;
+      if constexpr (!kShiftsInPlace) RotateTail(index, count);
+    } else {
+      OpenGap(index, count);
+      try {
+        build(data_ + index);
+      } catch (...) {
+        CloseGap(index, count);
+        throw;
+      }
+      size_ += count;
+    }
+  }
+
+  // Moves the last count elements in front of index. Only the basic
+  // guarantee holds if a move throws, as for std::vector.
+  void RotateTail(size_type index, size_type count) {
+    if (index + count < size_)
+      std::rotate(data_ + index, data_ + size_ - count, data_ + size_);
+  }
+
+  // Shrinks by destroying the tail or grows by letting fill(gap, n) build n
+  // new elements at the end.
+  template <typename Filler>
+  void Resize(size_type count, Filler fill) {
+    if (count <= size_) {
+      DestroyTail(count);
+    } else {
+      size_type extra = count - size_;
+      InsertWithGap(size_, extra, [&](pointer gap) { fill(gap, extra); });
+    }
+  }
+
+  // Destroys the elements from index count on; the capacity is kept.
+  void DestroyTail(size_type count) noexcept {
+    if constexpr (!std::is_trivially_destructible<T>::value)
+      for (size_type i = count; i < size_; i++)
+        std::allocator_traits<Alloc>::destroy(alloc, data_ + i);
+    size_ = count;
+  }
+
+  template <typename ForwardIt>
+  void InsertRange(size_type index, ForwardIt first, ForwardIt last,
+                   std::forward_iterator_tag) {
+    size_type count = std::distance(first, last);
+    InsertWithGap(index, count, [&](pointer gap) {
+      ForwardIt it = first;
+      ConstructN(gap, count, [&](pointer p) {
+        std::allocator_traits<Alloc>::construct(alloc, p, *it++);
+      });
+    });
+  }
+
+  // Single-pass input can not be measured up front: append, then rotate the
+  // new tail into place.
+  template <typename InputIt>
+  void InsertRange(size_type index, InputIt first, InputIt last,
+                   std::input_iterator_tag) {
+    size_type old_size = size_;
+    for (; first != last; ++first) emplace_back(*first);
+    RotateTail(index, size_ - old_size);
+  }
+
+  // Growing insertion of a single element built from args.
+  template <typename... Args>
+  void GrowAndEmplace(size_type index, Args &&...args) {
+    if constexpr (kUsesRealloc) {
+      // realloc may free the old block, so arguments referring into it have
+      // to be read before growing.
+      value_type temp(std::forward<Args>(args)...);
+      ReallocateWithGap(index, 1, [&](pointer gap) {
+        std::allocator_traits<Alloc>::construct(alloc, gap, std::move(temp));
+      });
+    } else {
+      ReallocateWithGap(index, 1, [&](pointer gap) {
+        std::allocator_traits<Alloc>::construct(alloc, gap,
+                                                std::forward<Args>(args)...);
+      });
+    }
+  }
+
+  // Allocates a grown buffer with count raw slots at index, lets build fill
+  // them and moves the old elements around the gap. Strong guarantee.
+  // In realloc mode build must not read from the old buffer.
+  template <typename Builder>
+  void ReallocateWithGap(size_type index, size_type count, Builder build) {
+    size_type new_capacity = RecommendCapacity(size_ + count);
+    if constexpr (kUsesRealloc) {
+      ReallocateMemory(new_capacity);
+      OpenGap(index, count);
+      try {
+        build(data_ + index);
+      } catch (...) {
+        CloseGap(index, count);
+        throw;
+      }
+      size_ += count;
+      return;
+    }
+    pointer newdata = AllocateBuffer(new_capacity);
+    bool built = false;
+    pointer prefix_end = newdata;
+    try {
+      build(newdata + index);
+      built = true;
+      if constexpr (!kRelocatable) {
+        prefix_end = MoveToUninitialized(data_, data_ + index, newdata);
+        MoveToUninitialized(data_ + index, data_ + size_,
+                            newdata + index + count);
+      }
+    } catch (...) {
+      for (pointer p = newdata; p != prefix_end; ++p)
+        std::allocator_traits<Alloc>::destroy(alloc, p);
+      if (built)
+        for (size_type i = 0; i < count; i++)
+          std::allocator_traits<Alloc>::destroy(alloc, newdata + index + i);
+      DeallocateBuffer(newdata, new_capacity);
+      throw;
+    }
+    if constexpr (kRelocatable) {
+      CopyBytes(newdata, data_, index);
+      CopyBytes(newdata + index + count, data_ + index, size_ - index);
+      DeallocateRelocated();
+    } else {
+      DeallocateMemory();
+    }
+    data_ = newdata;
+    capacity_ = new_capacity;
+    size_ += count;
+  }
 };
 
+// Removes every element matching pred in one stable compaction pass, without
+// allocating, and returns how many were removed.
+template <typename T, typename Alloc, typename Growth, typename Predicate>
+typename vector<T, Alloc, Growth>::size_type erase_if(
+    vector<T, Alloc, Growth> &v, Predicate pred) {
+  auto tail = std::remove_if(v.begin(), v.end(), pred);
+  auto removed = v.end() - tail;
+  v.erase(tail, v.end());
+  return removed;
+}
+
+template <typename T, typename Alloc, typename Growth, typename U>
+typename vector<T, Alloc, Growth>::size_type erase(
+    vector<T, Alloc, Growth> &v, const U &value) {
+  return erase_if(v, [&](const auto &item) { return item == value; });
+}
+
 };  // namespace s21
 
+#include "s21_vector_bool.h"
+
 #endif  // S21_VECTOR_H
\ No newline at end of file
@@ -0,0 +1,543 @@
+#ifndef S21_VECTOR_BOOL_H
+#define S21_VECTOR_BOOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+
+#include "s21_vector.h"
+#include "s21_vector_simd.h"
+
+namespace s21 {
+
+// Proxy for a single bit of a packed s21::vector<bool>.
+class BitReference {
+ public:
+  using word_type = std::uint64_t;
+
+  BitReference(word_type *word, word_type mask) noexcept
+      : word_(word), mask_(mask) {}
+
+  operator bool() const noexcept { return (*word_ & mask_) != 0; }
+
+  BitReference &operator=(bool value) noexcept {
+    if (value)
+      *word_ |= mask_;
+    else
+      *word_ &= ~mask_;
+    return *this;
+  }
+
+  BitReference &operator=(const BitReference &other) noexcept {
+    return *this = static_cast<bool>(other);
+  }
+
+  bool operator~() const noexcept { return !static_cast<bool>(*this); }
+
+  void flip() noexcept { *word_ ^= mask_; }
+
+ private:
+  word_type *word_;
+  word_type mask_;
+};
+
+template <bool IsIterConst = false>
+struct BitIterator {
+ public:
+  using word_type = std::uint64_t;
+  using value_type = bool;
+  using difference_type = ptrdiff_t;
+  using pointer = void;
+  using reference = std::conditional_t<IsIterConst, bool, BitReference>;
+  using iterator_category = std::random_access_iterator_tag;
+
+  BitIterator() noexcept : words_(nullptr), index_(0) {}
+
+  BitIterator(word_type *words, std::size_t index) noexcept
+      : words_(words), index_(index) {}
+
+  template <bool IsOtherConst,
+            typename = std::enable_if_t<IsIterConst && !IsOtherConst>>
+  BitIterator(const BitIterator<IsOtherConst> &other) noexcept
+      : words_(other.words_), index_(other.index_) {}
+
+  reference operator*() const {
+    return BitReference(words_ + (index_ >> 6), word_type(1) << (index_ & 63));
+  }
+
+  reference operator[](difference_type n) const { return *(*this + n); }
+
+  BitIterator &operator++() {
+    ++index_;
+    return *this;
+  }
+
+  BitIterator operator++(int) {
+    BitIterator temp = *this;
+    ++(*this);
+    return temp;
+  }
+
+  BitIterator &operator--() {
+    --index_;
+    return *this;
+  }
+
+  BitIterator operator--(int) {
+    BitIterator temp = *this;
+    --(*this);
+    return temp;
+  }
+
+  BitIterator operator+(difference_type rhs) const {
+    return BitIterator(words_, index_ + rhs);
+  }
+
+  friend BitIterator operator+(difference_type lhs, const BitIterator &rhs) {
+    return rhs + lhs;
+  }
+
+  BitIterator operator-(difference_type rhs) const {
+    return BitIterator(words_, index_ - rhs);
+  }
+
+  friend difference_type operator-(const BitIterator &lhs,
+                                   const BitIterator &rhs) {
+    return static_cast<difference_type>(lhs.index_) -
+           static_cast<difference_type>(rhs.index_);
+  }
+
+  BitIterator &operator+=(difference_type rhs) {
+    index_ += rhs;
+    return *this;
+  }
+
+  BitIterator &operator-=(difference_type rhs) {
+    index_ -= rhs;
+    return *this;
+  }
+
+  friend bool operator==(const BitIterator &lhs,
+                         const BitIterator &rhs) noexcept {
+    return lhs.index_ == rhs.index_;
+  }
+
+  friend bool operator!=(const BitIterator &lhs,
+                         const BitIterator &rhs) noexcept {
+    return lhs.index_ != rhs.index_;
+  }
+
+  friend bool operator<(const BitIterator &lhs,
+                        const BitIterator &rhs) noexcept {
+    return lhs.index_ < rhs.index_;
+  }
+
+  friend bool operator>(const BitIterator &lhs,
+                        const BitIterator &rhs) noexcept {
+    return lhs.index_ > rhs.index_;
+  }
+
+  friend bool operator<=(const BitIterator &lhs,
+                         const BitIterator &rhs) noexcept {
+    return lhs.index_ <= rhs.index_;
+  }
+
+  friend bool operator>=(const BitIterator &lhs,
+                         const BitIterator &rhs) noexcept {
+    return lhs.index_ >= rhs.index_;
+  }
+
+  std::size_t index() const noexcept { return index_; }
+
+ private:
+  template <bool>
+  friend struct BitIterator;
+
+  word_type *words_;
+  std::size_t index_;
+};
+
+// One bit per element, stored in 64-bit words kept in an s21::vector, so
+// the allocator and growth policy behave as for any other vector. Bits past
+// size() in the last word are always zero.
+template <typename Alloc, typename Growth>
+class vector<bool, Alloc, Growth> {
+ public:
+  using word_type = std::uint64_t;
+  using value_type = bool;
+  using reference = BitReference;
+  using const_reference = bool;
+  using size_type = std::size_t;
+  using iterator = BitIterator<false>;
+  using const_iterator = BitIterator<true>;
+
+  static constexpr size_type bits_per_word = 64;
+
+  vector() : size_(0) {}
+
+  vector(size_type n) : size_(0) { insert(this->cend(), n, false); }
+
+  vector(std::initializer_list<value_type> const &items) : size_(0) {
+    insert(this->cend(), items.begin(), items.end());
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  vector(InputIt first, InputIt last) : size_(0) {
+    insert(this->cend(), first, last);
+  }
+
+  vector(const vector &v) = default;
+
+  vector(vector &&v) noexcept : words_(std::move(v.words_)), size_(v.size_) {
+    v.size_ = 0;
+  }
+
+  ~vector() = default;
+
+  vector &operator=(const vector &v) = default;
+
+  vector &operator=(vector &&v) noexcept {
+    if (this != &v) {
+      words_ = std::move(v.words_);
+      size_ = v.size_;
+      v.size_ = 0;
+    }
+    return *this;
+  }
+
+  reference at(size_type pos) {
+    if (pos >= size_) throw std::out_of_range("Index out of range.");
+    return (*this)[pos];
+  }
+
+  reference operator[](size_type pos) {
+    return reference(words_.data() + pos / bits_per_word,
+                     word_type(1) << (pos % bits_per_word));
+  }
+
+  const_reference front() const {
+    if (size_ == 0)
+      throw std::out_of_range("Getting front() from empty vector.");
+    return Test(0);
+  }
+
+  const_reference back() const {
+    if (size_ == 0)
+      throw std::out_of_range("Getting back() from empty vector\n");
+    return Test(size_ - 1);
+  }
+
+  const_iterator cbegin() const noexcept { return const_iterator(Words(), 0); }
+
+  const_iterator cend() const noexcept {
+    return const_iterator(Words(), size_);
+  }
+
+  iterator begin() const noexcept { return iterator(Words(), 0); }
+
+  iterator end() const noexcept { return iterator(Words(), size_); }
+
+  bool empty() const noexcept { return size_ == 0; }
+
+  size_type size() const noexcept { return size_; }
+
+  size_type max_size() const noexcept {
+    return words_.max_size() * bits_per_word;
+  }
+
+  void reserve(size_type size) { words_.reserve(WordsFor(size)); }
+
+  size_type capacity() const noexcept {
+    return words_.capacity() * bits_per_word;
+  }
+
+  void shrink_to_fit() { words_.shrink_to_fit(); }
+
+  void resize(size_type count, value_type value = false) {
+    if (count > size_) {
+      insert(this->cend(), count - size_, value);
+    } else {
+      size_ = count;
+      words_.resize(WordsFor(count));
+      ClearTail();
+    }
+  }
+
+  void clear() noexcept {
+    words_.clear();
+    size_ = 0;
+  }
+
+  iterator insert(const_iterator pos, value_type value) {
+    return insert(pos, 1, value);
+  }
+
+  iterator insert(const_iterator pos, size_type count, value_type value) {
+    size_type index = CheckedIndex(pos);
+    OpenGap(index, count);
+    set_range(index, index + count, value);
+    return iterator(Words(), index);
+  }
+
+  template <typename InputIt, typename = RequireInputIterator<InputIt>>
+  iterator insert(const_iterator pos, InputIt first, InputIt last) {
+    size_type index = CheckedIndex(pos);
+    if constexpr (std::is_convertible<
+                      typename std::iterator_traits<InputIt>::iterator_category,
+                      std::forward_iterator_tag>::value) {
+      OpenGap(index, std::distance(first, last));
+      for (size_type i = index; first != last; ++first, ++i)
+        (*this)[i] = static_cast<bool>(*first);
+    } else {
+      vector buffered;
+      for (; first != last; ++first) buffered.push_back(*first);
+      insert(pos, buffered.cbegin(), buffered.cend());
+    }
+    return iterator(Words(), index);
+  }
+
+  iterator insert(const_iterator pos,
+                  std::initializer_list<value_type> items) {
+    return insert(pos, items.begin(), items.end());
+  }
+
+  template <typename... Args>
+  iterator emplace(const_iterator pos, Args &&...args) {
+    return insert(pos, 1, value_type(std::forward<Args>(args)...));
+  }
+
+  void erase(iterator pos) {
+    if (pos < this->begin() || pos >= this->end())
+      throw std::out_of_range("Iterator out of range");
+    size_type index = pos.index();
+    MoveBits(index, index + 1, size_ - index - 1);
+    pop_back();
+  }
+
+  iterator erase(const_iterator first, const_iterator last) {
+    size_type index = CheckedIndex(first);
+    size_type end = CheckedIndex(last);
+    if (end < index) throw std::out_of_range("Iterator out of range");
+    MoveBits(index, end, size_ - end);
+    size_ -= end - index;
+    words_.resize(WordsFor(size_));
+    ClearTail();
+    return iterator(Words(), index);
+  }
+
+  void push_back(value_type value) {
+    if (size_ % bits_per_word == 0) words_.push_back(0);
+    (*this)[size_++] = value;
+  }
+
+  template <typename... Args>
+  reference emplace_back(Args &&...args) {
+    push_back(value_type(std::forward<Args>(args)...));
+    return (*this)[size_ - 1];
+  }
+
+  void pop_back() {
+    if (size_ > 0) {
+      (*this)[--size_] = false;
+      if (size_ % bits_per_word == 0) words_.pop_back();
+    }
+  }
+
+  void swap(vector &other) {
+    words_.swap(other.words_);
+    std::swap(size_, other.size_);
+  }
+
+  // Number of set bits, with the popcnt instruction where the CPU has it.
+  size_type count() const noexcept {
+    return simd::DispatchPopcount(
+        [&](auto kernel) { return kernel.Count(Words(), words_.size()); });
+  }
+
+  // Index of the first set bit, or size() if there is none.
+  size_type find_first() const noexcept {
+    const word_type *words = Words();
+    for (size_type i = 0; i < words_.size(); i++)
+      if (words[i] != 0)
+        return i * bits_per_word + __builtin_ctzll(words[i]);
+    return size_;
+  }
+
+  void flip() noexcept {
+    word_type *words = Words();
+    for (size_type i = 0; i < words_.size(); i++) words[i] = ~words[i];
+    ClearTail();
+  }
+
+  void flip(size_type pos) { (*this)[pos].flip(); }
+
+  // Assigns value to every bit in [first, last).
+  void set_range(size_type first, size_type last, value_type value) {
+    if (first > last || last > size_)
+      throw std::out_of_range("Bit range out of range");
+    if (first == last) return;
+    word_type *words = Words();
+    size_type first_word = first / bits_per_word;
+    size_type last_word = (last - 1) / bits_per_word;
+    word_type head = ~word_type(0) << (first % bits_per_word);
+    word_type tail =
+        ~word_type(0) >> (bits_per_word - 1 - (last - 1) % bits_per_word);
+    if (first_word == last_word) {
+      ApplyMask(words[first_word], head & tail, value);
+    } else {
+      ApplyMask(words[first_word], head, value);
+      word_type fill = value ? ~word_type(0) : 0;
+      for (size_type i = first_word + 1; i < last_word; i++) words[i] = fill;
+      ApplyMask(words[last_word], tail, value);
+    }
+  }
+
+  vector &operator&=(const vector &other) {
+    CheckSameSize(other);
+    word_type *words = Words();
+    const word_type *rhs = other.Words();
+    for (size_type i = 0; i < words_.size(); i++) words[i] &= rhs[i];
+    return *this;
+  }
+
+  vector &operator|=(const vector &other) {
+    CheckSameSize(other);
+    word_type *words = Words();
+    const word_type *rhs = other.Words();
+    for (size_type i = 0; i < words_.size(); i++) words[i] |= rhs[i];
+    return *this;
+  }
+
+  vector &operator^=(const vector &other) {
+    CheckSameSize(other);
+    word_type *words = Words();
+    const word_type *rhs = other.Words();
+    for (size_type i = 0; i < words_.size(); i++) words[i] ^= rhs[i];
+    return *this;
+  }
+
+  friend vector operator&(vector lhs, const vector &rhs) { return lhs &= rhs; }
+
+  friend vector operator|(vector lhs, const vector &rhs) { return lhs |= rhs; }
+
+  friend vector operator^(vector lhs, const vector &rhs) { return lhs ^= rhs; }
+
+ private:
+  using word_alloc =
+      typename std::allocator_traits<Alloc>::template rebind_alloc<word_type>;
+
+  s21::vector<word_type, word_alloc, Growth> words_;
+  size_type size_;
+
+  word_type *Words() const noexcept {
+    return const_cast<s21::vector<word_type, word_alloc, Growth> &>(words_)
+        .data();
+  }
+
+  static size_type WordsFor(size_type bits) noexcept {
+    return (bits + bits_per_word - 1) / bits_per_word;
+  }
+
+  bool Test(size_type pos) const noexcept {
+    return (Words()[pos / bits_per_word] >> (pos % bits_per_word)) & 1;
+  }
+
+  static void ApplyMask(word_type &word, word_type mask, bool value) noexcept {
+    if (value)
+      word |= mask;
+    else
+      word &= ~mask;
+  }
+
+  void ClearTail() noexcept {
+    if (size_ % bits_per_word != 0)
+      Words()[size_ / bits_per_word] &=
+          ~word_type(0) >> (bits_per_word - size_ % bits_per_word);
+  }
+
+  void CheckSameSize(const vector &other) const {
+    if (size_ != other.size_)
+      throw std::invalid_argument("Bit vectors have different sizes.");
+  }
+
+  size_type CheckedIndex(const_iterator pos) const {
+    if (pos < this->cbegin() || pos > this->cend())
+      throw std::out_of_range("Iterator out of range");
+    return pos.index();
+  }
+
+  // Reads len (1..64) bits starting at bit, which may span two words.
+  word_type LoadBits(size_type bit, size_type len) const noexcept {
+    const word_type *words = Words();
+    size_type word = bit / bits_per_word;
+    size_type offset = bit % bits_per_word;
+    word_type value = words[word] >> offset;
+    if (offset != 0 && offset + len > bits_per_word)
+      value |= words[word + 1] << (bits_per_word - offset);
+    if (len < bits_per_word) value &= (word_type(1) << len) - 1;
+    return value;
+  }
+
+  void StoreBits(size_type bit, size_type len, word_type value) noexcept {
+    word_type *words = Words();
+    size_type word = bit / bits_per_word;
+    size_type offset = bit % bits_per_word;
+    word_type mask =
+        len < bits_per_word ? (word_type(1) << len) - 1 : ~word_type(0);
+    words[word] = (words[word] & ~(mask << offset)) | (value << offset);
+    if (offset != 0 && offset + len > bits_per_word) {
+      size_type shift = bits_per_word - offset;
+      words[word + 1] =
+          (words[word + 1] & ~(mask >> shift)) | (value >> shift);
+    }
+  }
+
+  // memmove for bits: copies count bits from src to dst a word at a time,
+  // walking in the direction that keeps overlapping ranges intact.
+  void MoveBits(size_type dst, size_type src, size_type count) noexcept {
+    if (dst == src || count == 0) return;
+    if (dst > src) {
+      while (count > 0) {
+        size_type len = count < bits_per_word ? count : bits_per_word;
+        count -= len;
+        StoreBits(dst + count, len, LoadBits(src + count, len));
+      }
+    } else {
+      for (size_type done = 0; done < count; done += bits_per_word) {
+        size_type len =
+            count - done < bits_per_word ? count - done : bits_per_word;
+        StoreBits(dst + done, len, LoadBits(src + done, len));
+      }
+    }
+  }
+
+  // Grows by count bits and moves [index, old size) up to make room.
+  void OpenGap(size_type index, size_type count) {
+    if (count == 0) return;
+    size_type old_size = size_;
+    size_type needed = WordsFor(size_ + count);
+    if (needed > words_.size())
+      words_.insert(words_.cend(), needed - words_.size(), 0);
+    size_ += count;
+    MoveBits(index + count, index, old_size - index);
+  }
+};
+
+// Once every bit equal to value is gone only !value bits remain, so the
+// population count is all that is needed.
+template <typename Alloc, typename Growth>
+std::size_t erase(vector<bool, Alloc, Growth> &v, bool value) {
+  std::size_t ones = v.count();
+  std::size_t removed = value ? ones : v.size() - ones;
+  v.resize(v.size() - removed);
+  v.set_range(0, v.size(), !value);
+  return removed;
+}
+
+};  // namespace s21
+
+#endif  // S21_VECTOR_BOOL_H
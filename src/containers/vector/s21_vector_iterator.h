@@ -3,6 +3,7 @@
 
 #include <cstddef>
 #include <iterator>
+#include <type_traits>
 
 #include "s21_vector.h"
 
@@ -26,6 +27,11 @@ struct VectorIterator {
 
   VectorIterator(pointer ptr) : ptr_(ptr) {}
 
+  template <bool IsOtherConst,
+            typename = std::enable_if_t<IsIterConst && !IsOtherConst>>
+  VectorIterator(const VectorIterator<T, IsOtherConst>& other) noexcept
+      : ptr_(other.ptr_) {}
+
   meta_reference operator*() const { return *ptr_; }
 
   meta_pointer operator->() const { return ptr_; }
@@ -121,6 +127,9 @@ struct VectorIterator {
   }
 
  private:
+  template <typename, bool>
+  friend struct VectorIterator;
+
   pointer ptr_;
 };
 
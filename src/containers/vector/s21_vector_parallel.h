@@ -0,0 +1,301 @@
+#ifndef S21_VECTOR_PARALLEL_H
+#define S21_VECTOR_PARALLEL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+
+#include "../queue/s21_queue.h"
+#include "s21_vector.h"
+
+namespace s21 {
+
+namespace parallel {
+
+// Fixed set of worker threads shared by every parallel algorithm. The thread
+// that calls run() takes part in the work, so a pool with no workers simply
+// runs everything on the caller.
+class thread_pool {
+ public:
+  // If a thread can not be started, the ones already running are stopped
+  // and joined before the error is rethrown.
+  explicit thread_pool(std::size_t workers) : stop_(false) {
+    workers_.reserve(workers);
+    try {
+      for (std::size_t i = 0; i < workers; i++)
+        workers_.push_back(std::thread([this] { WorkerLoop(); }));
+    } catch (...) {
+      StopWorkers();
+      throw;
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  ~thread_pool() { StopWorkers(); }
+
+  // One worker per hardware thread besides the caller's.
+  static thread_pool &shared() {
+    static thread_pool pool(
+        std::max(std::thread::hardware_concurrency(), 1u) - 1);
+    return pool;
+  }
+
+  std::size_t size() const noexcept { return workers_.size(); }
+
+  // Calls task(i) for every i in [0, count) and returns once all calls have
+  // finished. The first exception thrown by a task is rethrown here.
+  template <typename Task>
+  void run(std::size_t count, Task task) {
+    if (count == 0) return;
+    auto batch = std::make_shared<Batch>(count);
+    batch->body = [&task](std::size_t i) { task(i); };
+    std::size_t helpers = std::min(count - 1, size());
+    if (helpers != 0) {
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        for (std::size_t i = 0; i < helpers; i++) pending_.push(batch);
+      }
+      wake_.notify_all();
+    }
+    batch->Work();
+    batch->Wait();
+    if (batch->error) std::rethrow_exception(batch->error);
+  }
+
+ private:
+  // Indices are claimed from an atomic counter, so a worker that picks the
+  // batch up after the caller has drained it returns without touching body.
+  struct Batch {
+    explicit Batch(std::size_t n) : count(n), next(0), done(0) {}
+
+    void Work() {
+      for (std::size_t i; (i = next.fetch_add(1)) < count;) {
+        try {
+          body(i);
+        } catch (...) {
+          std::lock_guard<std::mutex> lock(mutex);
+          if (!error) error = std::current_exception();
+        }
+        if (done.fetch_add(1) + 1 == count) {
+          std::lock_guard<std::mutex> lock(mutex);
+          finished.notify_all();
+        }
+      }
+    }
+
+    void Wait() {
+      std::unique_lock<std::mutex> lock(mutex);
+      finished.wait(lock, [this] { return done.load() == count; });
+    }
+
+    const std::size_t count;
+    std::atomic<std::size_t> next;
+    std::atomic<std::size_t> done;
+    std::function<void(std::size_t)> body;
+    std::exception_ptr error;
+    std::mutex mutex;
+    std::condition_variable finished;
+  };
+
+  void StopWorkers() noexcept {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_) worker.join();
+  }
+
+  void WorkerLoop() {
+    for (;;) {
+      std::shared_ptr<Batch> batch;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock, [this] { return stop_ || !pending_.empty(); });
+        if (pending_.empty()) return;
+        batch = pending_.front();
+        pending_.pop();
+      }
+      batch->Work();
+    }
+  }
+
+  s21::vector<std::thread> workers_;
+  s21::queue<std::shared_ptr<Batch>> pending_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  bool stop_;
+};
+
+// Smallest slice of a vector worth handing to another thread.
+constexpr std::size_t kMinChunk = 4096;
+
+inline std::size_t ChunkCount(const thread_pool &pool, std::size_t n) {
+  return std::max<std::size_t>(
+      std::min(pool.size() + 1, n / kMinChunk), n == 0 ? 0 : 1);
+}
+
+inline std::size_t ChunkBegin(std::size_t n, std::size_t chunks,
+                              std::size_t i) {
+  return n / chunks * i + std::min(i, n % chunks);
+}
+
+// Calls body(first, last, chunk) for consecutive index ranges covering
+// [0, n) and returns the number of chunks used.
+template <typename Body>
+std::size_t ForChunks(thread_pool &pool, std::size_t n, Body body) {
+  std::size_t chunks = ChunkCount(pool, n);
+  pool.run(chunks, [&](std::size_t i) {
+    body(ChunkBegin(n, chunks, i), ChunkBegin(n, chunks, i + 1), i);
+  });
+  return chunks;
+}
+
+template <typename T, typename Alloc, typename Growth, typename Function>
+void for_each(thread_pool &pool, vector<T, Alloc, Growth> &v, Function f) {
+  T *data = v.data();
+  ForChunks(pool, v.size(), [&](std::size_t first, std::size_t last, auto) {
+    for (; first != last; first++) f(data[first]);
+  });
+}
+
+template <typename T, typename Alloc, typename Growth, typename Function>
+void for_each(vector<T, Alloc, Growth> &v, Function f) {
+  for_each(thread_pool::shared(), v, f);
+}
+
+// out is replaced by a vector of in.size() elements unless it already has
+// that size; in and out may be the same vector.
+template <typename T, typename Alloc, typename Growth, typename U,
+          typename OutAlloc, typename OutGrowth, typename UnaryOp>
+void transform(thread_pool &pool, const vector<T, Alloc, Growth> &in,
+               vector<U, OutAlloc, OutGrowth> &out, UnaryOp op) {
+  if (out.size() != in.size())
+    out = vector<U, OutAlloc, OutGrowth>(in.size());
+  const T *src = in.data();
+  U *dest = out.data();
+  ForChunks(pool, in.size(), [&](std::size_t first, std::size_t last, auto) {
+    for (; first != last; first++) dest[first] = op(src[first]);
+  });
+}
+
+template <typename T, typename Alloc, typename Growth, typename U,
+          typename OutAlloc, typename OutGrowth, typename UnaryOp>
+void transform(const vector<T, Alloc, Growth> &in,
+               vector<U, OutAlloc, OutGrowth> &out, UnaryOp op) {
+  transform(thread_pool::shared(), in, out, op);
+}
+
+// op must be associative; chunks are combined left to right, so it does not
+// have to be commutative.
+template <typename T, typename Alloc, typename Growth,
+          typename BinaryOp = std::plus<>>
+T reduce(thread_pool &pool, const vector<T, Alloc, Growth> &v, T init,
+         BinaryOp op = BinaryOp()) {
+  const T *data = v.data();
+  std::size_t n = v.size(), chunks = ChunkCount(pool, n);
+  vector<T> partials;
+  partials.reserve(chunks);
+  for (std::size_t i = 0; i < chunks; i++)
+    partials.push_back(data[ChunkBegin(n, chunks, i)]);
+  pool.run(chunks, [&](std::size_t i) {
+    std::size_t last = ChunkBegin(n, chunks, i + 1);
+    for (std::size_t k = ChunkBegin(n, chunks, i) + 1; k < last; k++)
+      partials[i] = op(std::move(partials[i]), data[k]);
+  });
+  for (auto &partial : partials) init = op(std::move(init), partial);
+  return init;
+}
+
+template <typename T, typename Alloc, typename Growth,
+          typename BinaryOp = std::plus<>>
+T reduce(const vector<T, Alloc, Growth> &v, T init, BinaryOp op = BinaryOp()) {
+  return reduce(thread_pool::shared(), v, std::move(init), op);
+}
+
+// Scans every chunk locally, carries the chunk totals forward sequentially
+// and then adds the carries in parallel. op must be associative; out follows
+// the same sizing rules as transform and may alias in.
+template <typename T, typename Alloc, typename Growth, typename OutAlloc,
+          typename OutGrowth, typename BinaryOp = std::plus<>>
+void inclusive_scan(thread_pool &pool, const vector<T, Alloc, Growth> &in,
+                    vector<T, OutAlloc, OutGrowth> &out,
+                    BinaryOp op = BinaryOp()) {
+  std::size_t n = in.size(), chunks = ChunkCount(pool, n);
+  if (out.size() != n) out = vector<T, OutAlloc, OutGrowth>(n);
+  const T *src = in.data();
+  T *dest = out.data();
+  pool.run(chunks, [&](std::size_t i) {
+    std::size_t first = ChunkBegin(n, chunks, i);
+    std::size_t last = ChunkBegin(n, chunks, i + 1);
+    dest[first] = src[first];
+    for (std::size_t k = first + 1; k < last; k++)
+      dest[k] = op(dest[k - 1], src[k]);
+  });
+  if (chunks < 2) return;
+  vector<T> carries;
+  carries.reserve(chunks - 1);
+  carries.push_back(dest[ChunkBegin(n, chunks, 1) - 1]);
+  for (std::size_t i = 1; i + 1 < chunks; i++)
+    carries.push_back(
+        op(carries[i - 1], dest[ChunkBegin(n, chunks, i + 1) - 1]));
+  pool.run(chunks - 1, [&](std::size_t i) {
+    std::size_t last = ChunkBegin(n, chunks, i + 2);
+    for (std::size_t k = ChunkBegin(n, chunks, i + 1); k < last; k++)
+      dest[k] = op(carries[i], dest[k]);
+  });
+}
+
+template <typename T, typename Alloc, typename Growth, typename OutAlloc,
+          typename OutGrowth, typename BinaryOp = std::plus<>>
+void inclusive_scan(const vector<T, Alloc, Growth> &in,
+                    vector<T, OutAlloc, OutGrowth> &out,
+                    BinaryOp op = BinaryOp()) {
+  inclusive_scan(thread_pool::shared(), in, out, op);
+}
+
+// Sorts the chunks independently, then merges neighbouring runs pairwise,
+// halving the number of runs each round. Not stable.
+template <typename T, typename Alloc, typename Growth,
+          typename Compare = std::less<>>
+void sort(thread_pool &pool, vector<T, Alloc, Growth> &v,
+          Compare comp = Compare()) {
+  T *data = v.data();
+  std::size_t n = v.size();
+  std::size_t chunks = ForChunks(
+      pool, n, [&](std::size_t first, std::size_t last, auto) {
+        std::sort(data + first, data + last, comp);
+      });
+  for (std::size_t width = 1; width < chunks; width *= 2) {
+    pool.run((chunks + 2 * width - 1) / (2 * width), [&](std::size_t j) {
+      std::size_t first = 2 * width * j;
+      std::size_t middle = std::min(first + width, chunks);
+      std::size_t last = std::min(first + 2 * width, chunks);
+      if (middle != last)
+        std::inplace_merge(data + ChunkBegin(n, chunks, first),
+                           data + ChunkBegin(n, chunks, middle),
+                           data + ChunkBegin(n, chunks, last), comp);
+    });
+  }
+}
+
+template <typename T, typename Alloc, typename Growth,
+          typename Compare = std::less<>>
+void sort(vector<T, Alloc, Growth> &v, Compare comp = Compare()) {
+  sort(thread_pool::shared(), v, comp);
+}
+
+}  // namespace parallel
+
+};  // namespace s21
+
+#endif  // S21_VECTOR_PARALLEL_H
@@ -0,0 +1,515 @@
+#ifndef S21_VECTOR_SIMD_H
+#define S21_VECTOR_SIMD_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <type_traits>
+
+#if defined(__SSE2__) && (defined(__GNUC__) || defined(__clang__))
+#define S21_SIMD_X86 1
+#include <immintrin.h>
+#endif
+
+namespace s21 {
+
+// Search and reduction kernels for contiguous arithmetic data. int32_t and
+// float go through SSE2 or, when the CPU reports it at runtime, AVX2; every
+// other arithmetic type and every non-x86 build uses the scalar loops.
+// Floating point min/max do not order NaNs, and float sums are accumulated
+// in double lanes, so the rounding may differ from a sequential loop.
+namespace simd {
+
+template <typename T>
+using sum_type = std::conditional_t<
+    std::is_floating_point<T>::value,
+    std::conditional_t<(sizeof(T) > sizeof(double)), T, double>,
+    std::conditional_t<std::is_signed<T>::value, long long,
+                       unsigned long long>>;
+
+template <typename T>
+using RequireArithmetic = std::enable_if_t<std::is_arithmetic<T>::value &&
+                                           !std::is_same<T, bool>::value>;
+
+template <typename T>
+struct Identity {
+  using type = T;
+};
+
+template <typename T>
+struct ScalarKernels {
+  static std::size_t Find(const T *data, std::size_t n, T value) {
+    for (std::size_t i = 0; i < n; i++)
+      if (data[i] == value) return i;
+    return n;
+  }
+
+  static std::size_t Count(const T *data, std::size_t n, T value) {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < n; i++) total += data[i] == value;
+    return total;
+  }
+
+  static T Min(const T *data, std::size_t n, T init) {
+    for (std::size_t i = 0; i < n; i++)
+      if (data[i] < init) init = data[i];
+    return init;
+  }
+
+  static T Max(const T *data, std::size_t n, T init) {
+    for (std::size_t i = 0; i < n; i++)
+      if (init < data[i]) init = data[i];
+    return init;
+  }
+
+  static sum_type<T> Sum(const T *data, std::size_t n) {
+    sum_type<T> total = 0;
+    for (std::size_t i = 0; i < n; i++) total += data[i];
+    return total;
+  }
+};
+
+#ifdef S21_SIMD_X86
+
+template <typename T>
+struct Sse2Kernels;
+
+template <typename T>
+struct Avx2Kernels;
+
+template <>
+struct Sse2Kernels<std::int32_t> {
+  using Scalar = ScalarKernels<std::int32_t>;
+
+  static __m128i Load(const std::int32_t *p) {
+    return _mm_loadu_si128(reinterpret_cast<const __m128i *>(p));
+  }
+
+  static std::size_t Find(const std::int32_t *data, std::size_t n,
+                          std::int32_t value) {
+    const __m128i needle = _mm_set1_epi32(value);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      int mask = _mm_movemask_epi8(_mm_cmpeq_epi32(Load(data + i), needle));
+      if (mask != 0) return i + __builtin_ctz(mask) / 4;
+    }
+    return i + Scalar::Find(data + i, n - i, value);
+  }
+
+  static std::size_t Count(const std::int32_t *data, std::size_t n,
+                           std::int32_t value) {
+    const __m128i needle = _mm_set1_epi32(value);
+    std::size_t total = 0, i = 0;
+    for (; i + 4 <= n; i += 4)
+      total += __builtin_popcount(_mm_movemask_ps(
+          _mm_castsi128_ps(_mm_cmpeq_epi32(Load(data + i), needle))));
+    return total + Scalar::Count(data + i, n - i, value);
+  }
+
+  // SSE2 has no 32-bit integer min/max, so lanes are selected by mask.
+  static std::int32_t Min(const std::int32_t *data, std::size_t n,
+                          std::int32_t init) {
+    __m128i best = _mm_set1_epi32(init);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128i block = Load(data + i);
+      __m128i less = _mm_cmplt_epi32(block, best);
+      best = _mm_or_si128(_mm_and_si128(less, block),
+                          _mm_andnot_si128(less, best));
+    }
+    alignas(16) std::int32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), best);
+    return Scalar::Min(data + i, n - i, Scalar::Min(lanes, 4, init));
+  }
+
+  static std::int32_t Max(const std::int32_t *data, std::size_t n,
+                          std::int32_t init) {
+    __m128i best = _mm_set1_epi32(init);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128i block = Load(data + i);
+      __m128i greater = _mm_cmpgt_epi32(block, best);
+      best = _mm_or_si128(_mm_and_si128(greater, block),
+                          _mm_andnot_si128(greater, best));
+    }
+    alignas(16) std::int32_t lanes[4];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), best);
+    return Scalar::Max(data + i, n - i, Scalar::Max(lanes, 4, init));
+  }
+
+  static long long Sum(const std::int32_t *data, std::size_t n) {
+    __m128i total = _mm_setzero_si128();
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128i block = Load(data + i);
+      __m128i sign = _mm_srai_epi32(block, 31);
+      total = _mm_add_epi64(total, _mm_unpacklo_epi32(block, sign));
+      total = _mm_add_epi64(total, _mm_unpackhi_epi32(block, sign));
+    }
+    alignas(16) long long lanes[2];
+    _mm_store_si128(reinterpret_cast<__m128i *>(lanes), total);
+    return lanes[0] + lanes[1] + Scalar::Sum(data + i, n - i);
+  }
+};
+
+template <>
+struct Sse2Kernels<float> {
+  using Scalar = ScalarKernels<float>;
+
+  static std::size_t Find(const float *data, std::size_t n, float value) {
+    const __m128 needle = _mm_set1_ps(value);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      int mask = _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), needle));
+      if (mask != 0) return i + __builtin_ctz(mask);
+    }
+    return i + Scalar::Find(data + i, n - i, value);
+  }
+
+  static std::size_t Count(const float *data, std::size_t n, float value) {
+    const __m128 needle = _mm_set1_ps(value);
+    std::size_t total = 0, i = 0;
+    for (; i + 4 <= n; i += 4)
+      total += __builtin_popcount(
+          _mm_movemask_ps(_mm_cmpeq_ps(_mm_loadu_ps(data + i), needle)));
+    return total + Scalar::Count(data + i, n - i, value);
+  }
+
+  static float Min(const float *data, std::size_t n, float init) {
+    __m128 best = _mm_set1_ps(init);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) best = _mm_min_ps(best, _mm_loadu_ps(data + i));
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, best);
+    return Scalar::Min(data + i, n - i, Scalar::Min(lanes, 4, init));
+  }
+
+  static float Max(const float *data, std::size_t n, float init) {
+    __m128 best = _mm_set1_ps(init);
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) best = _mm_max_ps(best, _mm_loadu_ps(data + i));
+    alignas(16) float lanes[4];
+    _mm_store_ps(lanes, best);
+    return Scalar::Max(data + i, n - i, Scalar::Max(lanes, 4, init));
+  }
+
+  static double Sum(const float *data, std::size_t n) {
+    __m128d total = _mm_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 4 <= n; i += 4) {
+      __m128 block = _mm_loadu_ps(data + i);
+      total = _mm_add_pd(total, _mm_cvtps_pd(block));
+      total = _mm_add_pd(total, _mm_cvtps_pd(_mm_movehl_ps(block, block)));
+    }
+    alignas(16) double lanes[2];
+    _mm_store_pd(lanes, total);
+    return lanes[0] + lanes[1] + Scalar::Sum(data + i, n - i);
+  }
+};
+
+#define S21_TARGET_AVX2 __attribute__((target("avx2")))
+
+template <>
+struct Avx2Kernels<std::int32_t> {
+  using Scalar = ScalarKernels<std::int32_t>;
+
+  S21_TARGET_AVX2 static __m256i Load(const std::int32_t *p) {
+    return _mm256_loadu_si256(reinterpret_cast<const __m256i *>(p));
+  }
+
+  S21_TARGET_AVX2 static std::size_t Find(const std::int32_t *data,
+                                          std::size_t n, std::int32_t value) {
+    const __m256i needle = _mm256_set1_epi32(value);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      int mask =
+          _mm256_movemask_epi8(_mm256_cmpeq_epi32(Load(data + i), needle));
+      if (mask != 0) return i + __builtin_ctz(mask) / 4;
+    }
+    return i + Scalar::Find(data + i, n - i, value);
+  }
+
+  S21_TARGET_AVX2 static std::size_t Count(const std::int32_t *data,
+                                           std::size_t n, std::int32_t value) {
+    const __m256i needle = _mm256_set1_epi32(value);
+    std::size_t total = 0, i = 0;
+    for (; i + 8 <= n; i += 8)
+      total += __builtin_popcount(_mm256_movemask_ps(
+          _mm256_castsi256_ps(_mm256_cmpeq_epi32(Load(data + i), needle))));
+    return total + Scalar::Count(data + i, n - i, value);
+  }
+
+  S21_TARGET_AVX2 static std::int32_t Min(const std::int32_t *data,
+                                          std::size_t n, std::int32_t init) {
+    __m256i best = _mm256_set1_epi32(init);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) best = _mm256_min_epi32(best, Load(data + i));
+    alignas(32) std::int32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), best);
+    return Scalar::Min(data + i, n - i, Scalar::Min(lanes, 8, init));
+  }
+
+  S21_TARGET_AVX2 static std::int32_t Max(const std::int32_t *data,
+                                          std::size_t n, std::int32_t init) {
+    __m256i best = _mm256_set1_epi32(init);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) best = _mm256_max_epi32(best, Load(data + i));
+    alignas(32) std::int32_t lanes[8];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), best);
+    return Scalar::Max(data + i, n - i, Scalar::Max(lanes, 8, init));
+  }
+
+  S21_TARGET_AVX2 static long long Sum(const std::int32_t *data,
+                                       std::size_t n) {
+    __m256i total = _mm256_setzero_si256();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      __m256i block = Load(data + i);
+      total = _mm256_add_epi64(
+          total, _mm256_cvtepi32_epi64(_mm256_castsi256_si128(block)));
+      total = _mm256_add_epi64(
+          total, _mm256_cvtepi32_epi64(_mm256_extracti128_si256(block, 1)));
+    }
+    alignas(32) long long lanes[4];
+    _mm256_store_si256(reinterpret_cast<__m256i *>(lanes), total);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+           Scalar::Sum(data + i, n - i);
+  }
+};
+
+template <>
+struct Avx2Kernels<float> {
+  using Scalar = ScalarKernels<float>;
+
+  S21_TARGET_AVX2 static std::size_t Find(const float *data, std::size_t n,
+                                          float value) {
+    const __m256 needle = _mm256_set1_ps(value);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      int mask = _mm256_movemask_ps(
+          _mm256_cmp_ps(_mm256_loadu_ps(data + i), needle, _CMP_EQ_OQ));
+      if (mask != 0) return i + __builtin_ctz(mask);
+    }
+    return i + Scalar::Find(data + i, n - i, value);
+  }
+
+  S21_TARGET_AVX2 static std::size_t Count(const float *data, std::size_t n,
+                                           float value) {
+    const __m256 needle = _mm256_set1_ps(value);
+    std::size_t total = 0, i = 0;
+    for (; i + 8 <= n; i += 8)
+      total += __builtin_popcount(_mm256_movemask_ps(
+          _mm256_cmp_ps(_mm256_loadu_ps(data + i), needle, _CMP_EQ_OQ)));
+    return total + Scalar::Count(data + i, n - i, value);
+  }
+
+  S21_TARGET_AVX2 static float Min(const float *data, std::size_t n,
+                                   float init) {
+    __m256 best = _mm256_set1_ps(init);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+      best = _mm256_min_ps(best, _mm256_loadu_ps(data + i));
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, best);
+    return Scalar::Min(data + i, n - i, Scalar::Min(lanes, 8, init));
+  }
+
+  S21_TARGET_AVX2 static float Max(const float *data, std::size_t n,
+                                   float init) {
+    __m256 best = _mm256_set1_ps(init);
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8)
+      best = _mm256_max_ps(best, _mm256_loadu_ps(data + i));
+    alignas(32) float lanes[8];
+    _mm256_store_ps(lanes, best);
+    return Scalar::Max(data + i, n - i, Scalar::Max(lanes, 8, init));
+  }
+
+  S21_TARGET_AVX2 static double Sum(const float *data, std::size_t n) {
+    __m256d total = _mm256_setzero_pd();
+    std::size_t i = 0;
+    for (; i + 8 <= n; i += 8) {
+      __m256 block = _mm256_loadu_ps(data + i);
+      total = _mm256_add_pd(total,
+                            _mm256_cvtps_pd(_mm256_castps256_ps128(block)));
+      total = _mm256_add_pd(total,
+                            _mm256_cvtps_pd(_mm256_extractf128_ps(block, 1)));
+    }
+    alignas(32) double lanes[4];
+    _mm256_store_pd(lanes, total);
+    return lanes[0] + lanes[1] + lanes[2] + lanes[3] +
+           Scalar::Sum(data + i, n - i);
+  }
+};
+
+#undef S21_TARGET_AVX2
+
+#endif  // S21_SIMD_X86
+
+template <typename T>
+struct HasVectorKernels
+    : std::integral_constant<bool, std::is_same<T, std::int32_t>::value ||
+                                       std::is_same<T, float>::value> {};
+
+inline bool HasAvx2() noexcept {
+#ifdef S21_SIMD_X86
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+#else
+  return false;
+#endif
+}
+
+// Calls op with the best kernel set available for T on this CPU.
+template <typename T, typename Op>
+auto Dispatch(Op op) {
+#ifdef S21_SIMD_X86
+  if constexpr (HasVectorKernels<T>::value)
+    return HasAvx2() ? op(Avx2Kernels<T>()) : op(Sse2Kernels<T>());
+#endif
+  return op(ScalarKernels<T>());
+}
+
+// Number of set bits in n words, used by s21::vector<bool>::count(). Without
+// -mpopcnt the compiler lowers __builtin_popcountll to a libgcc routine; the
+// popcnt kernel is compiled for the instruction and picked when the CPU
+// reports it.
+struct ScalarPopcountKernel {
+  static std::size_t Count(const std::uint64_t *words,
+                           std::size_t n) noexcept {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < n; i++) total += __builtin_popcountll(words[i]);
+    return total;
+  }
+};
+
+#ifdef S21_SIMD_X86
+
+struct PopcntKernel {
+  __attribute__((target("popcnt"))) static std::size_t Count(
+      const std::uint64_t *words, std::size_t n) noexcept {
+    std::size_t total = 0;
+    for (std::size_t i = 0; i < n; i++) total += __builtin_popcountll(words[i]);
+    return total;
+  }
+};
+
+#endif  // S21_SIMD_X86
+
+inline bool HasPopcnt() noexcept {
+#ifdef S21_SIMD_X86
+  static const bool supported = __builtin_cpu_supports("popcnt");
+  return supported;
+#else
+  return false;
+#endif
+}
+
+template <typename Op>
+auto DispatchPopcount(Op op) {
+#ifdef S21_SIMD_X86
+  if (HasPopcnt()) return op(PopcntKernel());
+#endif
+  return op(ScalarPopcountKernel());
+}
+
+// Index of the first element equal to value, or n.
+template <typename T, typename = RequireArithmetic<T>>
+std::size_t find(const T *data, std::size_t n,
+                 typename Identity<T>::type value) {
+  return Dispatch<T>(
+      [&](auto kernels) { return decltype(kernels)::Find(data, n, value); });
+}
+
+template <typename T, typename = RequireArithmetic<T>>
+std::size_t count(const T *data, std::size_t n,
+                  typename Identity<T>::type value) {
+  return Dispatch<T>(
+      [&](auto kernels) { return decltype(kernels)::Count(data, n, value); });
+}
+
+template <typename T, typename = RequireArithmetic<T>>
+bool contains(const T *data, std::size_t n,
+              typename Identity<T>::type value) {
+  return find(data, n, value) != n;
+}
+
+// n must be positive.
+template <typename T, typename = RequireArithmetic<T>>
+T min(const T *data, std::size_t n) {
+  return Dispatch<T>([&](auto kernels) {
+    return decltype(kernels)::Min(data + 1, n - 1, data[0]);
+  });
+}
+
+template <typename T, typename = RequireArithmetic<T>>
+T max(const T *data, std::size_t n) {
+  return Dispatch<T>([&](auto kernels) {
+    return decltype(kernels)::Max(data + 1, n - 1, data[0]);
+  });
+}
+
+template <typename T, typename = RequireArithmetic<T>>
+sum_type<T> sum(const T *data, std::size_t n) {
+  return Dispatch<T>(
+      [&](auto kernels) { return decltype(kernels)::Sum(data, n); });
+}
+
+}  // namespace simd
+
+};  // namespace s21
+
+// s21_vector_bool.h includes this header for the popcount kernels, so
+// everything above has to be declared before s21::vector is.
+#include "s21_vector.h"
+
+namespace s21 {
+
+namespace simd {
+
+template <typename T, typename Alloc, typename Growth,
+          typename = RequireArithmetic<T>>
+typename vector<T, Alloc, Growth>::const_iterator find(
+    const vector<T, Alloc, Growth> &v, typename Identity<T>::type value) {
+  return v.cbegin() + find(v.data(), v.size(), value);
+}
+
+template <typename T, typename Alloc, typename Growth,
+          typename = RequireArithmetic<T>>
+std::size_t count(const vector<T, Alloc, Growth> &v,
+                  typename Identity<T>::type value) {
+  return count(v.data(), v.size(), value);
+}
+
+template <typename T, typename Alloc, typename Growth,
+          typename = RequireArithmetic<T>>
+bool contains(const vector<T, Alloc, Growth> &v,
+              typename Identity<T>::type value) {
+  return contains(v.data(), v.size(), value);
+}
+
+template <typename T, typename Alloc, typename Growth,
+          typename = RequireArithmetic<T>>
+T min(const vector<T, Alloc, Growth> &v) {
+  if (v.empty()) throw std::out_of_range("Getting min() of empty vector.");
+  return min(v.data(), v.size());
+}
+
+template <typename T, typename Alloc, typename Growth,
+          typename = RequireArithmetic<T>>
+T max(const vector<T, Alloc, Growth> &v) {
+  if (v.empty()) throw std::out_of_range("Getting max() of empty vector.");
+  return max(v.data(), v.size());
+}
+
+template <typename T, typename Alloc, typename Growth,
+          typename = RequireArithmetic<T>>
+sum_type<T> sum(const vector<T, Alloc, Growth> &v) {
+  return sum(v.data(), v.size());
+}
+
+}  // namespace simd
+
+};  // namespace s21
+
+#endif  // S21_VECTOR_SIMD_H
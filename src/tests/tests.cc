@@ -1,10 +1,19 @@
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <fstream>
 #include <list>
 #include <map>
+#include <mutex>
+#include <numeric>
 #include <queue>
 #include <set>
+#include <sstream>
 #include <stack>
+#include <thread>
 #include <vector>
 
 #include "../containers/s21_containers.h"
@@ -541,6 +550,1777 @@ TEST(VectorTest, Helpers_add_memotysize_3) {
   EXPECT_EQ(s21_v.size(), std_v.size());
 }
 
+template <typename T>
+struct CountingAllocator {
+  using value_type = T;
+
+  static inline std::size_t allocations = 0;
+
+  CountingAllocator() = default;
+
+  template <typename U>
+  CountingAllocator(const CountingAllocator<U>&) noexcept {}
+
+  T* allocate(std::size_t n) {
+    allocations++;
+    return std::allocator<T>().allocate(n);
+  }
+
+  void deallocate(T* p, std::size_t n) { std::allocator<T>().deallocate(p, n); }
+
+  friend bool operator==(const CountingAllocator&, const CountingAllocator&) {
+    return true;
+  }
+
+  friend bool operator!=(const CountingAllocator&, const CountingAllocator&) {
+    return false;
+  }
+};
+
+TEST(VectorTest, Modifiers_insert_in_capacity_no_allocations) {
+  s21::vector<int, CountingAllocator<int>> s21_v{1, 2, 3, 4, 5};
+  std::vector<int> std_v{1, 2, 3, 4, 5};
+  s21_v.reserve(100);
+  CountingAllocator<int>::allocations = 0;
+  for (int i = 0; i < 50; i++) {
+    s21_v.insert(s21_v.begin() + 2, i);
+    std_v.insert(std_v.begin() + 2, i);
+  }
+  EXPECT_EQ(CountingAllocator<int>::allocations, 0);
+  EXPECT_EQ(s21_v.capacity(), 100);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (std::size_t i = 0; i < std_v.size(); i++) EXPECT_EQ(s21_v[i], std_v[i]);
+}
+
+TEST(VectorTest, Modifiers_erase_no_allocations) {
+  s21::vector<int, CountingAllocator<int>> s21_v{1, 2, 3, 4, 5, 6, 7, 8};
+  std::vector<int> std_v{1, 2, 3, 4, 5, 6, 7, 8};
+  CountingAllocator<int>::allocations = 0;
+  s21_v.erase(s21_v.begin() + 3);
+  std_v.erase(std_v.begin() + 3);
+  s21_v.erase(s21_v.begin());
+  std_v.erase(std_v.begin());
+  s21_v.erase(s21_v.end() - 1);
+  std_v.erase(std_v.end() - 1);
+  EXPECT_EQ(CountingAllocator<int>::allocations, 0);
+  EXPECT_EQ(s21_v.capacity(), 8);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (std::size_t i = 0; i < std_v.size(); i++) EXPECT_EQ(s21_v[i], std_v[i]);
+}
+
+TEST(VectorTest, Modifiers_insert_growth) {
+  s21::vector<int, CountingAllocator<int>> s21_v{1, 2, 3};
+  CountingAllocator<int>::allocations = 0;
+  s21_v.insert(s21_v.begin(), 0);
+  EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+  EXPECT_EQ(s21_v.capacity(), 6);
+  s21_v.insert(s21_v.begin() + 2, 7);
+  s21_v.insert(s21_v.end(), 9);
+  EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+  s21::vector<int> expected{0, 1, 7, 2, 3, 9};
+  ASSERT_EQ(s21_v.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); i++)
+    EXPECT_EQ(s21_v[i], expected[i]);
+}
+
+TEST(VectorTest, Modifiers_insert_self_reference) {
+  s21::vector<std::string> s21_v{"a", "b", "c"};
+  s21_v.reserve(10);
+  s21_v.insert(s21_v.begin(), s21_v[2]);
+  s21_v.insert(s21_v.begin() + 1, s21_v[0]);
+  EXPECT_EQ(s21_v[0], "c");
+  EXPECT_EQ(s21_v[1], "c");
+  EXPECT_EQ(s21_v[2], "a");
+  EXPECT_EQ(s21_v[3], "b");
+  EXPECT_EQ(s21_v[4], "c");
+}
+
+TEST(VectorTest, Modifiers_insert_erase_strings) {
+  s21::vector<std::string> s21_v;
+  std::vector<std::string> std_v;
+  for (int i = 0; i < 20; i++) {
+    s21_v.insert(s21_v.begin() + s21_v.size() / 2, std::to_string(i));
+    std_v.insert(std_v.begin() + std_v.size() / 2, std::to_string(i));
+  }
+  for (int i = 0; i < 7; i++) {
+    s21_v.erase(s21_v.begin() + i);
+    std_v.erase(std_v.begin() + i);
+  }
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (std::size_t i = 0; i < std_v.size(); i++) EXPECT_EQ(s21_v[i], std_v[i]);
+}
+
+struct CopyCounter {
+  static inline int copies = 0;
+  static inline int moves = 0;
+
+  std::string payload;
+
+  CopyCounter(std::string s = "") : payload(std::move(s)) {}
+  CopyCounter(int n, char c) : payload(n, c) {}
+  CopyCounter(const CopyCounter& other) : payload(other.payload) { copies++; }
+  CopyCounter(CopyCounter&& other) noexcept
+      : payload(std::move(other.payload)) {
+    moves++;
+  }
+  CopyCounter& operator=(const CopyCounter& other) {
+    payload = other.payload;
+    copies++;
+    return *this;
+  }
+  CopyCounter& operator=(CopyCounter&& other) noexcept {
+    payload = std::move(other.payload);
+    moves++;
+    return *this;
+  }
+
+  static void Reset() { copies = moves = 0; }
+};
+
+TEST(VectorTest, Modifiers_emplace_back_no_copies) {
+  s21::vector<CopyCounter> s21_v;
+  CopyCounter::Reset();
+  for (int i = 0; i < 100; i++) s21_v.emplace_back(i + 1, 'x');
+  EXPECT_EQ(CopyCounter::copies, 0);
+  EXPECT_EQ(s21_v.size(), 100);
+  EXPECT_EQ(s21_v[0].payload, "x");
+  EXPECT_EQ(s21_v[99].payload, std::string(100, 'x'));
+  EXPECT_EQ(s21_v.emplace_back("last").payload, "last");
+}
+
+TEST(VectorTest, Modifiers_push_back_rvalue_no_copies) {
+  s21::vector<CopyCounter> s21_v;
+  CopyCounter::Reset();
+  for (int i = 0; i < 100; i++) s21_v.push_back(CopyCounter(std::to_string(i)));
+  EXPECT_EQ(CopyCounter::copies, 0);
+  for (int i = 0; i < 100; i++) EXPECT_EQ(s21_v[i].payload, std::to_string(i));
+
+  CopyCounter lvalue("copied");
+  s21_v.push_back(lvalue);
+  EXPECT_EQ(CopyCounter::copies, 1);
+  EXPECT_EQ(s21_v.back().payload, "copied");
+}
+
+TEST(VectorTest, Modifiers_emplace) {
+  s21::vector<CopyCounter> s21_v;
+  s21_v.reserve(10);
+  s21_v.emplace_back("b");
+  s21_v.emplace_back("d");
+  CopyCounter::Reset();
+  auto it = s21_v.emplace(s21_v.begin(), "a");
+  EXPECT_EQ(it->payload, "a");
+  it = s21_v.emplace(s21_v.cbegin() + 2, "c");
+  EXPECT_EQ(it->payload, "c");
+  it = s21_v.emplace(s21_v.end(), "e");
+  EXPECT_EQ(it->payload, "e");
+  EXPECT_EQ(CopyCounter::copies, 0);
+  ASSERT_EQ(s21_v.size(), 5);
+  EXPECT_EQ(s21_v[0].payload, "a");
+  EXPECT_EQ(s21_v[1].payload, "b");
+  EXPECT_EQ(s21_v[2].payload, "c");
+  EXPECT_EQ(s21_v[3].payload, "d");
+  EXPECT_EQ(s21_v[4].payload, "e");
+  EXPECT_ANY_THROW(s21_v.emplace(s21_v.end() + 1, "f"));
+}
+
+TEST(VectorTest, Modifiers_insert_rvalue) {
+  s21::vector<std::string> s21_v{"b"};
+  std::string value = "a";
+  s21_v.insert(s21_v.begin(), std::move(value));
+  EXPECT_EQ(s21_v.front(), "a");
+  EXPECT_EQ(s21_v.back(), "b");
+}
+
+TEST(VectorTest, Constructor_iterators) {
+  std::list<int> source{5, 4, 3, 2, 1};
+  s21::vector<int, CountingAllocator<int>>::size_type before =
+      CountingAllocator<int>::allocations;
+  s21::vector<int, CountingAllocator<int>> s21_v(source.begin(), source.end());
+  std::vector<int> std_v(source.begin(), source.end());
+  EXPECT_EQ(CountingAllocator<int>::allocations - before, 1);
+  EXPECT_EQ(s21_v.size(), std_v.size());
+  EXPECT_EQ(s21_v.capacity(), std_v.capacity());
+  for (std::size_t i = 0; i < std_v.size(); i++) EXPECT_EQ(s21_v[i], std_v[i]);
+}
+
+TEST(VectorTest, Constructor_input_iterators) {
+  std::istringstream stream("1 2 3 4");
+  s21::vector<int> s21_v{std::istream_iterator<int>(stream),
+                         std::istream_iterator<int>()};
+  ASSERT_EQ(s21_v.size(), 4);
+  EXPECT_EQ(s21_v[0], 1);
+  EXPECT_EQ(s21_v[3], 4);
+}
+
+TEST(VectorTest, Modifiers_insert_range) {
+  s21::vector<int, CountingAllocator<int>> s21_v{1, 2, 3};
+  std::vector<int> std_v{1, 2, 3};
+  std::vector<int> source(1000);
+  for (int i = 0; i < 1000; i++) source[i] = i * 3;
+  CountingAllocator<int>::allocations = 0;
+  auto it = s21_v.insert(s21_v.begin() + 1, source.begin(), source.end());
+  std_v.insert(std_v.begin() + 1, source.begin(), source.end());
+  EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+  EXPECT_EQ(*it, 0);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (std::size_t i = 0; i < std_v.size(); i++) EXPECT_EQ(s21_v[i], std_v[i]);
+}
+
+TEST(VectorTest, Modifiers_insert_range_in_capacity) {
+  s21::vector<std::string> s21_v{"a", "e"};
+  s21_v.reserve(10);
+  std::list<std::string> source{"b", "c", "d"};
+  auto it = s21_v.insert(s21_v.begin() + 1, source.begin(), source.end());
+  EXPECT_EQ(*it, "b");
+  EXPECT_EQ(s21_v.capacity(), 10);
+  s21::vector<std::string> expected{"a", "b", "c", "d", "e"};
+  ASSERT_EQ(s21_v.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); i++)
+    EXPECT_EQ(s21_v[i], expected[i]);
+}
+
+TEST(VectorTest, Modifiers_insert_input_range) {
+  std::istringstream stream("7 8 9");
+  s21::vector<int> s21_v{1, 2, 3};
+  s21_v.insert(s21_v.begin() + 1, std::istream_iterator<int>(stream),
+               std::istream_iterator<int>());
+  s21::vector<int> expected{1, 7, 8, 9, 2, 3};
+  ASSERT_EQ(s21_v.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); i++)
+    EXPECT_EQ(s21_v[i], expected[i]);
+}
+
+TEST(VectorTest, Modifiers_insert_count) {
+  s21::vector<int, CountingAllocator<int>> s21_v{1, 2, 3};
+  std::vector<int> std_v{1, 2, 3};
+  CountingAllocator<int>::allocations = 0;
+  s21_v.insert(s21_v.begin() + 2, 100, 7);
+  std_v.insert(std_v.begin() + 2, 100, 7);
+  EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+  s21_v.insert(s21_v.begin(), 0, 5);
+  std_v.insert(std_v.begin(), 0, 5);
+  s21_v.insert(s21_v.begin(), 2, s21_v[2]);
+  std_v.insert(std_v.begin(), 2, std_v[2]);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (std::size_t i = 0; i < std_v.size(); i++) EXPECT_EQ(s21_v[i], std_v[i]);
+}
+
+TEST(VectorTest, Modifiers_append_range) {
+  s21::vector<int, CountingAllocator<int>> s21_v{1, 2};
+  s21::vector<int> tail{3, 4, 5, 6};
+  CountingAllocator<int>::allocations = 0;
+  s21_v.append_range(tail);
+  EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+  s21_v.append_range(std::initializer_list<int>{7});
+  EXPECT_EQ(CountingAllocator<int>::allocations, 2);
+  ASSERT_EQ(s21_v.size(), 7);
+  for (int i = 0; i < 7; i++) EXPECT_EQ(s21_v[i], i + 1);
+}
+
+TEST(VectorTest, Modifiers_insert_range_throw) {
+  s21::vector<int> s21_v{1, 2, 3};
+  std::vector<int> source{4, 5};
+  EXPECT_ANY_THROW(
+      s21_v.insert(s21_v.end() + 1, source.begin(), source.end()));
+  EXPECT_EQ(s21_v.size(), 3);
+}
+
+struct RelocatableCounter {
+  static inline int moves = 0;
+  static inline int destroyed = 0;
+
+  std::unique_ptr<int> value;
+
+  RelocatableCounter(int v) : value(new int(v)) {}
+  RelocatableCounter(RelocatableCounter&& other) noexcept
+      : value(std::move(other.value)) {
+    moves++;
+  }
+  RelocatableCounter& operator=(RelocatableCounter&& other) noexcept {
+    value = std::move(other.value);
+    moves++;
+    return *this;
+  }
+  ~RelocatableCounter() { destroyed++; }
+};
+
+namespace s21 {
+template <>
+struct is_trivially_relocatable<RelocatableCounter> : std::true_type {};
+}  // namespace s21
+
+struct Point {
+  double x;
+  double y;
+};
+
+TEST(VectorTest, Relocation_trait) {
+  EXPECT_TRUE(s21::is_trivially_relocatable<int>::value);
+  EXPECT_TRUE(s21::is_trivially_relocatable<Point>::value);
+  EXPECT_FALSE(s21::is_trivially_relocatable<std::string>::value);
+  EXPECT_TRUE(s21::is_trivially_relocatable<RelocatableCounter>::value);
+}
+
+TEST(VectorTest, Relocation_bytewise) {
+  s21::vector<RelocatableCounter> s21_v;
+  for (int i = 0; i < 5; i++) s21_v.emplace_back(i);
+  RelocatableCounter::moves = RelocatableCounter::destroyed = 0;
+  s21_v.reserve(64);
+  s21_v.emplace(s21_v.begin() + 2, 10);
+  s21_v.insert(s21_v.begin(), RelocatableCounter(20));
+  s21_v.erase(s21_v.begin() + 1);
+  s21_v.shrink_to_fit();
+  EXPECT_EQ(RelocatableCounter::moves, 2);
+  EXPECT_EQ(RelocatableCounter::destroyed, 3);
+  int expected[] = {20, 1, 10, 2, 3, 4};
+  ASSERT_EQ(s21_v.size(), 6);
+  for (int i = 0; i < 6; i++) EXPECT_EQ(*s21_v[i].value, expected[i]);
+}
+
+TEST(VectorTest, Relocation_trivial_struct) {
+  s21::vector<Point> s21_v;
+  for (int i = 0; i < 100; i++) s21_v.push_back({double(i), double(-i)});
+  s21_v.insert(s21_v.begin() + 50, Point{0.5, 0.5});
+  s21_v.erase(s21_v.begin());
+  s21_v.shrink_to_fit();
+  EXPECT_EQ(s21_v.size(), 100);
+  EXPECT_EQ(s21_v.capacity(), 100);
+  EXPECT_EQ(s21_v[0].x, 1);
+  EXPECT_EQ(s21_v[49].y, 0.5);
+  EXPECT_EQ(s21_v[50].x, 50);
+  EXPECT_EQ(s21_v[99].y, -99);
+}
+
+struct RelocatableThrowingMove {
+  static inline bool throw_on_move = false;
+
+  int value;
+
+  RelocatableThrowingMove(int v) : value(v) {}
+  RelocatableThrowingMove(const RelocatableThrowingMove&) = default;
+  RelocatableThrowingMove(RelocatableThrowingMove&& other)
+      : value(other.value) {
+    if (throw_on_move) throw std::runtime_error("move");
+  }
+};
+
+namespace s21 {
+template <>
+struct is_trivially_relocatable<RelocatableThrowingMove> : std::true_type {};
+}  // namespace s21
+
+TEST(VectorTest, Relocation_emplace_throw_closes_gap) {
+  s21::vector<RelocatableThrowingMove> s21_v;
+  s21_v.reserve(8);
+  for (int i = 0; i < 4; i++) s21_v.emplace_back(i);
+  RelocatableThrowingMove::throw_on_move = true;
+  EXPECT_THROW(s21_v.emplace(s21_v.begin() + 1, 10), std::runtime_error);
+  RelocatableThrowingMove::throw_on_move = false;
+  ASSERT_EQ(s21_v.size(), 4);
+  for (int i = 0; i < 4; i++) EXPECT_EQ(s21_v[i].value, i);
+}
+
+struct MayThrowOnMove {
+  std::string text;
+
+  MayThrowOnMove(int i) : text(std::to_string(i)) {}
+  MayThrowOnMove(const MayThrowOnMove&) = default;
+  MayThrowOnMove(MayThrowOnMove&& other) : text(std::move(other.text)) {}
+  MayThrowOnMove& operator=(const MayThrowOnMove&) = default;
+  MayThrowOnMove& operator=(MayThrowOnMove&&) = default;
+};
+
+TEST(VectorTest, Emplace_uses_spare_capacity_without_nothrow_move) {
+  s21::vector<MayThrowOnMove> s21_v;
+  for (int i = 0; i < 12; i++) s21_v.emplace(s21_v.cend(), i);
+  for (int i = 12; i < 24; i++) s21_v.emplace(s21_v.cbegin() + 1, i);
+  s21_v.insert(s21_v.cbegin(), MayThrowOnMove(24));
+  EXPECT_EQ(s21_v.size(), 25);
+  EXPECT_LE(s21_v.capacity(), 32);
+  EXPECT_EQ(s21_v[0].text, "24");
+  EXPECT_EQ(s21_v[1].text, "0");
+  EXPECT_EQ(s21_v[2].text, "23");
+  EXPECT_EQ(s21_v[13].text, "12");
+  EXPECT_EQ(s21_v[14].text, "1");
+  EXPECT_EQ(s21_v[24].text, "11");
+}
+
+template <typename Growth>
+std::vector<std::size_t> CapacitySteps(int pushes) {
+  s21::vector<int, CountingAllocator<int>, Growth> s21_v;
+  std::vector<std::size_t> steps;
+  for (int i = 0; i < pushes; i++) {
+    s21_v.push_back(i);
+    if (steps.empty() || steps.back() != s21_v.capacity())
+      steps.push_back(s21_v.capacity());
+  }
+  for (int i = 0; i < pushes; i++) EXPECT_EQ(s21_v[i], i);
+  return steps;
+}
+
+struct TripleGrowth {
+  static std::size_t next_capacity(std::size_t current, std::size_t) {
+    return current * 3;
+  }
+};
+
+TEST(VectorTest, Growth_policies) {
+  EXPECT_EQ(CapacitySteps<s21::growth::doubling>(20),
+            (std::vector<std::size_t>{1, 2, 4, 8, 16, 32}));
+  EXPECT_EQ(CapacitySteps<s21::growth::one_and_half>(20),
+            (std::vector<std::size_t>{1, 2, 3, 4, 6, 9, 13, 19, 28}));
+  EXPECT_EQ(CapacitySteps<s21::growth::golden_ratio>(20),
+            (std::vector<std::size_t>{1, 2, 3, 4, 6, 9, 14, 22}));
+  EXPECT_EQ(CapacitySteps<s21::growth::fixed_chunk<8>>(20),
+            (std::vector<std::size_t>{8, 16, 24}));
+  EXPECT_EQ(CapacitySteps<TripleGrowth>(20),
+            (std::vector<std::size_t>{1, 3, 9, 27}));
+}
+
+TEST(VectorTest, Growth_policy_range_insert) {
+  s21::vector<int, std::allocator<int>, s21::growth::fixed_chunk<100>> s21_v;
+  std::vector<int> source(250, 1);
+  s21_v.insert(s21_v.begin(), source.begin(), source.end());
+  EXPECT_EQ(s21_v.capacity(), 300);
+  s21_v.insert(s21_v.begin() + 10, 60, 2);
+  EXPECT_EQ(s21_v.capacity(), 400);
+  EXPECT_EQ(s21_v[9], 1);
+  EXPECT_EQ(s21_v[10], 2);
+  EXPECT_EQ(s21_v[69], 2);
+  EXPECT_EQ(s21_v[70], 1);
+}
+
+TEST(VectorTest, Realloc_growth_large_buffer) {
+  s21::vector<long long> s21_v;
+  const long long n = 1 << 20;
+  for (long long i = 0; i < n; i++) s21_v.push_back(i * 7);
+  s21_v.insert(s21_v.begin() + 5, -1);
+  s21_v.emplace_back(s21_v[0]);
+  s21_v.erase(s21_v.begin());
+  ASSERT_EQ(s21_v.size(), static_cast<std::size_t>(n + 1));
+  EXPECT_EQ(s21_v[3], 28);
+  EXPECT_EQ(s21_v[4], -1);
+  EXPECT_EQ(s21_v[5], 35);
+  EXPECT_EQ(s21_v[n - 1], (n - 1) * 7);
+  EXPECT_EQ(s21_v.back(), 0);
+  s21_v.shrink_to_fit();
+  EXPECT_EQ(s21_v.capacity(), s21_v.size());
+  s21_v.clear();
+  s21_v.shrink_to_fit();
+  EXPECT_EQ(s21_v.capacity(), 0);
+}
+
+TEST(VectorTest, Realloc_self_reference_on_growth) {
+  s21::vector<int> s21_v{1, 2, 3, 4};
+  EXPECT_EQ(s21_v.capacity(), s21_v.size());
+  s21_v.push_back(s21_v[1]);
+  s21_v.insert(s21_v.begin(), s21_v[4]);
+  EXPECT_EQ(s21_v[0], 2);
+  EXPECT_EQ(s21_v[5], 2);
+}
+
+TEST(VectorTest, Resize) {
+  s21::vector<std::string> s21_v{"a", "b", "c"};
+  std::vector<std::string> std_v{"a", "b", "c"};
+  s21_v.resize(6);
+  std_v.resize(6);
+  s21_v.resize(8, "x");
+  std_v.resize(8, "x");
+  s21_v.resize(10, s21_v[0]);
+  std_v.resize(10, std_v[0]);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  EXPECT_TRUE(std::equal(std_v.begin(), std_v.end(), s21_v.begin()));
+  std::size_t capacity = s21_v.capacity();
+  s21_v.resize(2);
+  std_v.resize(2);
+  EXPECT_EQ(s21_v.capacity(), capacity);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  EXPECT_TRUE(std::equal(std_v.begin(), std_v.end(), s21_v.begin()));
+  s21_v.resize(0);
+  EXPECT_TRUE(s21_v.empty());
+}
+
+TEST(VectorTest, Resize_value_initializes) {
+  s21::vector<int, CountingAllocator<int>> s21_v(3);
+  for (int i = 0; i < 3; i++) EXPECT_EQ(s21_v[i], 0);
+  s21_v[0] = 5;
+  CountingAllocator<int>::allocations = 0;
+  s21_v.resize(1000);
+  EXPECT_EQ(CountingAllocator<int>::allocations, 1);
+  EXPECT_EQ(s21_v[0], 5);
+  for (int i = 1; i < 1000; i++) EXPECT_EQ(s21_v[i], 0);
+  s21::vector<int> filled(4, 7);
+  EXPECT_EQ(filled.size(), 4);
+  EXPECT_EQ(filled.capacity(), 4);
+  for (int i = 0; i < 4; i++) EXPECT_EQ(filled[i], 7);
+}
+
+TEST(VectorTest, Resize_default_init) {
+  s21::vector<int> s21_v{1, 2, 3, 4, 5};
+  s21_v.resize(2);
+  s21_v.resize_default_init(5);
+  // The bytes of the shrunk tail are reused as they are.
+  EXPECT_EQ(s21_v[2], 3);
+  EXPECT_EQ(s21_v[4], 5);
+  s21_v.resize_default_init(1 << 20);
+  s21_v[(1 << 20) - 1] = 9;
+  EXPECT_EQ(s21_v.size(), 1U << 20);
+  EXPECT_EQ(s21_v[1], 2);
+  s21::vector<char> buffer(4096, s21::default_init);
+  EXPECT_EQ(buffer.size(), 4096);
+  EXPECT_EQ(buffer.capacity(), 4096);
+  s21::vector<std::string> strings(3, s21::default_init);
+  strings.resize_default_init(5);
+  ASSERT_EQ(strings.size(), 5);
+  for (auto &str : strings) EXPECT_TRUE(str.empty());
+}
+
+struct ThrowingCopy {
+  static inline int copies = 0;
+
+  ThrowingCopy() = default;
+  ThrowingCopy(const ThrowingCopy&) { copies++; }
+  ThrowingCopy& operator=(const ThrowingCopy&) = default;
+};
+
+TEST(VectorTest, Resize_throwing_copy_appends_in_place) {
+  s21::vector<ThrowingCopy> s21_v;
+  s21_v.reserve(10);
+  s21_v.resize(3);
+  ThrowingCopy::copies = 0;
+  s21_v.resize(10);
+  EXPECT_EQ(s21_v.capacity(), 10);
+  EXPECT_EQ(ThrowingCopy::copies, 0);
+  s21_v.resize(11);
+  EXPECT_EQ(ThrowingCopy::copies, 10);
+}
+
+TEST(VectorTest, Modifiers_erase_range) {
+  s21::vector<std::string> s21_v{"a", "b", "c", "d", "e"};
+  std::vector<std::string> std_v{"a", "b", "c", "d", "e"};
+  auto it = s21_v.erase(s21_v.begin() + 1, s21_v.begin() + 3);
+  std_v.erase(std_v.begin() + 1, std_v.begin() + 3);
+  EXPECT_EQ(*it, "d");
+  s21_v.erase(s21_v.end(), s21_v.end());
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  EXPECT_TRUE(std::equal(std_v.begin(), std_v.end(), s21_v.begin()));
+  EXPECT_THROW(s21_v.erase(s21_v.end(), s21_v.begin()), std::out_of_range);
+  s21::vector<int> ints{1, 2, 3, 4};
+  ints.erase(ints.begin(), ints.end());
+  EXPECT_TRUE(ints.empty());
+  EXPECT_EQ(ints.capacity(), 4);
+}
+
+TEST(VectorTest, Erase_if_ratios) {
+  for (int ratio : {10, 50, 90}) {
+    s21::vector<int, CountingAllocator<int>> s21_v;
+    std::vector<int> std_v;
+    for (int i = 0; i < 10000; i++) {
+      s21_v.push_back(i);
+      std_v.push_back(i);
+    }
+    auto doomed = [ratio](int x) { return x % 100 < ratio; };
+    CountingAllocator<int>::allocations = 0;
+    EXPECT_EQ(s21::erase_if(s21_v, doomed), 100U * ratio);
+    EXPECT_EQ(CountingAllocator<int>::allocations, 0);
+    std_v.erase(std::remove_if(std_v.begin(), std_v.end(), doomed),
+                std_v.end());
+    ASSERT_EQ(s21_v.size(), std_v.size());
+    EXPECT_TRUE(std::equal(std_v.begin(), std_v.end(), s21_v.begin()));
+  }
+}
+
+TEST(VectorTest, Erase_value) {
+  s21::vector<std::string> s21_v{"x", "a", "x", "b", "x"};
+  EXPECT_EQ(s21::erase(s21_v, "x"), 3U);
+  ASSERT_EQ(s21_v.size(), 2);
+  EXPECT_EQ(s21_v[0], "a");
+  EXPECT_EQ(s21_v[1], "b");
+  EXPECT_EQ(s21::erase(s21_v, "y"), 0U);
+  s21::small_vector<int, 4> small{1, 2, 1, 3};
+  EXPECT_EQ(s21::erase(small, 1), 2U);
+  EXPECT_EQ(s21::erase_if(small, [](int x) { return x > 2; }), 1U);
+  ASSERT_EQ(small.size(), 1);
+  EXPECT_EQ(small[0], 2);
+}
+
+TEST(VectorBoolTest, Push_and_access) {
+  s21::vector<bool> s21_v;
+  std::vector<bool> std_v;
+  for (int i = 0; i < 200; i++) {
+    s21_v.push_back(i % 3 == 0);
+    std_v.push_back(i % 3 == 0);
+  }
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (std::size_t i = 0; i < std_v.size(); i++) EXPECT_EQ(s21_v[i], std_v[i]);
+  EXPECT_EQ(s21_v.capacity() % 64, 0);
+  EXPECT_TRUE(s21_v.front());
+  EXPECT_FALSE(s21_v.back());
+  s21_v[1] = true;
+  s21_v.at(2) = s21_v[0];
+  EXPECT_TRUE(s21_v[1]);
+  EXPECT_TRUE(s21_v[2]);
+  EXPECT_ANY_THROW(s21_v.at(200));
+}
+
+TEST(VectorBoolTest, Packed_storage) {
+  s21::vector<bool, CountingAllocator<bool>> s21_v;
+  s21_v.reserve(1000);
+  EXPECT_EQ(s21_v.capacity(), 1024);
+  CountingAllocator<bool>::allocations = 0;
+  for (int i = 0; i < 1000; i++) s21_v.push_back(true);
+  EXPECT_EQ(CountingAllocator<bool>::allocations, 0);
+  EXPECT_EQ(s21_v.count(), 1000);
+}
+
+TEST(VectorBoolTest, Insert_erase) {
+  s21::vector<bool> s21_v;
+  std::vector<bool> std_v;
+  for (int i = 0; i < 150; i++) {
+    s21_v.push_back(i % 5 == 1);
+    std_v.push_back(i % 5 == 1);
+  }
+  s21_v.insert(s21_v.begin() + 3, true);
+  std_v.insert(std_v.begin() + 3, true);
+  s21_v.insert(s21_v.begin() + 60, 70, true);
+  std_v.insert(std_v.begin() + 60, 70, true);
+  std::vector<bool> source{true, false, true, true};
+  s21_v.insert(s21_v.begin() + 10, source.begin(), source.end());
+  std_v.insert(std_v.begin() + 10, source.begin(), source.end());
+  for (int i = 0; i < 80; i++) {
+    s21_v.erase(s21_v.begin() + (i * 7) % s21_v.size());
+    std_v.erase(std_v.begin() + (i * 7) % std_v.size());
+  }
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (std::size_t i = 0; i < std_v.size(); i++) EXPECT_EQ(s21_v[i], std_v[i]);
+  EXPECT_EQ(s21_v.count(),
+            static_cast<std::size_t>(std::count(std_v.begin(), std_v.end(),
+                                                true)));
+}
+
+TEST(VectorBoolTest, Count_find_flip) {
+  s21::vector<bool> s21_v(300);
+  EXPECT_EQ(s21_v.count(), 0);
+  EXPECT_EQ(s21_v.find_first(), 300);
+  s21_v[257] = true;
+  s21_v[130] = true;
+  EXPECT_EQ(s21_v.find_first(), 130);
+  EXPECT_EQ(s21_v.count(), 2);
+  s21_v.flip();
+  EXPECT_EQ(s21_v.count(), 298);
+  EXPECT_EQ(s21_v.find_first(), 0);
+  s21_v.flip(0);
+  EXPECT_FALSE(s21_v[0]);
+  EXPECT_EQ(s21_v.find_first(), 1);
+}
+
+TEST(VectorBoolTest, Popcount_kernels_agree) {
+  std::vector<std::uint64_t> words(37);
+  std::uint64_t value = 1;
+  for (auto& word : words) {
+    value = value * 6364136223846793005ull + 1442695040888963407ull;
+    word = value;
+  }
+  std::size_t expected = 0;
+  for (std::uint64_t word : words)
+    for (; word != 0; word &= word - 1) expected++;
+  EXPECT_EQ(s21::simd::ScalarPopcountKernel::Count(words.data(), 37),
+            expected);
+  std::size_t dispatched = s21::simd::DispatchPopcount(
+      [&](auto kernel) { return kernel.Count(words.data(), 37); });
+  EXPECT_EQ(dispatched, expected);
+#ifdef S21_SIMD_X86
+  if (s21::simd::HasPopcnt()) {
+    EXPECT_EQ(s21::simd::PopcntKernel::Count(words.data(), 37), expected);
+  }
+#endif
+}
+
+TEST(VectorBoolTest, Set_range) {
+  s21::vector<bool> s21_v(200);
+  s21_v.set_range(3, 5, true);
+  EXPECT_EQ(s21_v.count(), 2);
+  s21_v.set_range(60, 190, true);
+  EXPECT_EQ(s21_v.count(), 132);
+  EXPECT_FALSE(s21_v[59]);
+  EXPECT_TRUE(s21_v[60]);
+  EXPECT_TRUE(s21_v[189]);
+  EXPECT_FALSE(s21_v[190]);
+  s21_v.set_range(64, 128, false);
+  EXPECT_EQ(s21_v.count(), 68);
+  s21_v.set_range(0, 200, true);
+  EXPECT_EQ(s21_v.count(), 200);
+  EXPECT_ANY_THROW(s21_v.set_range(10, 201, true));
+}
+
+TEST(VectorBoolTest, Bitwise) {
+  s21::vector<bool> a(130);
+  s21::vector<bool> b(130);
+  a.set_range(0, 100, true);
+  b.set_range(50, 130, true);
+  EXPECT_EQ((a & b).count(), 50);
+  EXPECT_EQ((a | b).count(), 130);
+  EXPECT_EQ((a ^ b).count(), 80);
+  a ^= b;
+  EXPECT_TRUE(a[0]);
+  EXPECT_FALSE(a[75]);
+  EXPECT_TRUE(a[120]);
+  s21::vector<bool> c(10);
+  EXPECT_ANY_THROW(a &= c);
+}
+
+TEST(VectorBoolTest, Iterators_copy_move) {
+  s21::vector<bool> s21_v{true, false, true, true, false};
+  EXPECT_EQ(std::count(s21_v.cbegin(), s21_v.cend(), true), 3);
+  for (auto it = s21_v.begin(); it != s21_v.end(); ++it) *it = !*it;
+  EXPECT_EQ(s21_v.count(), 2);
+  s21::vector<bool> copy(s21_v);
+  s21::vector<bool> moved(std::move(s21_v));
+  EXPECT_EQ(copy.size(), 5);
+  EXPECT_EQ(moved.count(), 2);
+  EXPECT_TRUE(s21_v.empty());
+  while (!moved.empty()) moved.pop_back();
+  EXPECT_EQ(moved.count(), 0);
+}
+
+TEST(VectorBoolTest, Resize) {
+  s21::vector<bool> s21_v(70);
+  std::vector<bool> std_v(70);
+  s21_v.resize(130, true);
+  std_v.resize(130, true);
+  s21_v.resize(100);
+  std_v.resize(100);
+  s21_v.resize(140);
+  std_v.resize(140);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (std::size_t i = 0; i < std_v.size(); i++) EXPECT_EQ(s21_v[i], std_v[i]);
+  EXPECT_EQ(s21_v.count(), 30U);
+}
+
+TEST(VectorBoolTest, Erase) {
+  s21::vector<bool> s21_v;
+  std::vector<bool> std_v;
+  for (int i = 0; i < 200; i++) {
+    s21_v.push_back(i % 3 == 0);
+    std_v.push_back(i % 3 == 0);
+  }
+  s21_v.erase(s21_v.begin() + 10, s21_v.begin() + 140);
+  std_v.erase(std_v.begin() + 10, std_v.begin() + 140);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (std::size_t i = 0; i < std_v.size(); i++) EXPECT_EQ(s21_v[i], std_v[i]);
+  std::size_t ones = s21_v.count();
+  EXPECT_EQ(s21::erase(s21_v, true), ones);
+  EXPECT_EQ(s21_v.count(), 0U);
+  EXPECT_EQ(s21_v.size(), std_v.size() - ones);
+  s21_v.push_back(true);
+  s21_v.push_back(true);
+  std::size_t index = 0;
+  EXPECT_EQ(s21::erase_if(s21_v, [&](bool) { return index++ % 2 == 0; }),
+            (s21_v.size() + 1) / 2);
+}
+
+// VECTOR SIMD
+
+TEST(VectorSimdTest, Find_and_contains_int) {
+  s21::vector<int> s21_v;
+  for (int i = 0; i < 1003; i++) s21_v.push_back(i * 2);
+  for (int target : {0, 2, 14, 16, 998, 2000, 2004}) {
+    auto it = s21::simd::find(s21_v, target);
+    auto expected = std::find(s21_v.cbegin(), s21_v.cend(), target);
+    EXPECT_EQ(it, expected);
+    EXPECT_TRUE(s21::simd::contains(s21_v, target));
+  }
+  EXPECT_EQ(s21::simd::find(s21_v, 3), s21_v.cend());
+  EXPECT_FALSE(s21::simd::contains(s21_v, 2006));
+  EXPECT_FALSE(s21::simd::contains(s21::vector<int>(), 0));
+}
+
+TEST(VectorSimdTest, Count_int_and_float) {
+  s21::vector<int> ints;
+  s21::vector<float> floats;
+  for (int i = 0; i < 1037; i++) {
+    ints.push_back(i % 7);
+    floats.push_back(static_cast<float>(i % 5) / 2);
+  }
+  EXPECT_EQ(s21::simd::count(ints, 3),
+            static_cast<std::size_t>(std::count(ints.begin(), ints.end(), 3)));
+  EXPECT_EQ(s21::simd::count(floats, 1.5f),
+            static_cast<std::size_t>(
+                std::count(floats.begin(), floats.end(), 1.5f)));
+  EXPECT_EQ(s21::simd::count(floats, 7.0f), 0);
+}
+
+TEST(VectorSimdTest, Min_max) {
+  s21::vector<int> ints;
+  s21::vector<float> floats;
+  for (int i = 0; i < 999; i++) {
+    ints.push_back((i * 7919) % 1000 - 500);
+    floats.push_back(static_cast<float>((i * 104729) % 777) - 300.5f);
+  }
+  ints[501] = -100000;
+  ints[998] = 100000;
+  EXPECT_EQ(s21::simd::min(ints), -100000);
+  EXPECT_EQ(s21::simd::max(ints), 100000);
+  EXPECT_EQ(s21::simd::min(floats),
+            *std::min_element(floats.begin(), floats.end()));
+  EXPECT_EQ(s21::simd::max(floats),
+            *std::max_element(floats.begin(), floats.end()));
+  s21::vector<int> single{42};
+  EXPECT_EQ(s21::simd::min(single), 42);
+  EXPECT_EQ(s21::simd::max(single), 42);
+  EXPECT_ANY_THROW(s21::simd::min(s21::vector<int>()));
+  EXPECT_ANY_THROW(s21::simd::max(s21::vector<float>()));
+}
+
+TEST(VectorSimdTest, Sum) {
+  s21::vector<int> ints(1000001);
+  for (int i = 0; i < 1000001; i++) ints[i] = i % 2 ? 2000000000 : -7;
+  long long expected = 0;
+  for (int i = 0; i < 1000001; i++) expected += ints[i];
+  EXPECT_EQ(s21::simd::sum(ints), expected);
+
+  s21::vector<float> floats;
+  for (int i = 0; i < 1001; i++) floats.push_back(0.25f * i);
+  EXPECT_DOUBLE_EQ(s21::simd::sum(floats), 0.25 * 1000 * 1001 / 2);
+  EXPECT_EQ(s21::simd::sum(s21::vector<float>()), 0.0);
+}
+
+TEST(VectorSimdTest, Scalar_fallback_types) {
+  s21::vector<double> doubles{3.5, -1.25, 8.0, 2.0, 8.0};
+  s21::vector<unsigned char> bytes{200, 100, 5};
+  EXPECT_EQ(s21::simd::find(doubles, 8.0) - doubles.cbegin(), 2);
+  EXPECT_EQ(s21::simd::count(doubles, 8.0), 2);
+  EXPECT_EQ(s21::simd::min(doubles), -1.25);
+  EXPECT_EQ(s21::simd::max(doubles), 8.0);
+  EXPECT_EQ(s21::simd::sum(bytes), 305u);
+}
+
+#ifdef S21_SIMD_X86
+TEST(VectorSimdTest, Kernels_agree_with_scalar) {
+  std::vector<int> ints(517);
+  std::vector<float> floats(517);
+  for (int i = 0; i < 517; i++) {
+    ints[i] = (i * 37) % 101 - 50;
+    floats[i] = static_cast<float>(ints[i]) / 4;
+  }
+  using ScalarInt = s21::simd::ScalarKernels<int>;
+  using ScalarFloat = s21::simd::ScalarKernels<float>;
+  using Sse2Int = s21::simd::Sse2Kernels<int>;
+  using Sse2Float = s21::simd::Sse2Kernels<float>;
+  const int* pi = ints.data();
+  const float* pf = floats.data();
+  EXPECT_EQ(Sse2Int::Find(pi, 517, 13), ScalarInt::Find(pi, 517, 13));
+  EXPECT_EQ(Sse2Int::Count(pi, 517, -4), ScalarInt::Count(pi, 517, -4));
+  EXPECT_EQ(Sse2Int::Min(pi, 517, 0), ScalarInt::Min(pi, 517, 0));
+  EXPECT_EQ(Sse2Int::Max(pi, 517, 0), ScalarInt::Max(pi, 517, 0));
+  EXPECT_EQ(Sse2Int::Sum(pi, 517), ScalarInt::Sum(pi, 517));
+  EXPECT_EQ(Sse2Float::Find(pf, 517, 3.25f), ScalarFloat::Find(pf, 517, 3.25f));
+  EXPECT_EQ(Sse2Float::Count(pf, 517, -1.f), ScalarFloat::Count(pf, 517, -1.f));
+  EXPECT_EQ(Sse2Float::Min(pf, 517, 0.f), ScalarFloat::Min(pf, 517, 0.f));
+  EXPECT_EQ(Sse2Float::Max(pf, 517, 0.f), ScalarFloat::Max(pf, 517, 0.f));
+  EXPECT_DOUBLE_EQ(Sse2Float::Sum(pf, 517), ScalarFloat::Sum(pf, 517));
+  if (s21::simd::HasAvx2()) {
+    using Avx2Int = s21::simd::Avx2Kernels<int>;
+    using Avx2Float = s21::simd::Avx2Kernels<float>;
+    EXPECT_EQ(Avx2Int::Find(pi, 517, 13), ScalarInt::Find(pi, 517, 13));
+    EXPECT_EQ(Avx2Int::Count(pi, 517, -4), ScalarInt::Count(pi, 517, -4));
+    EXPECT_EQ(Avx2Int::Min(pi, 517, 0), ScalarInt::Min(pi, 517, 0));
+    EXPECT_EQ(Avx2Int::Max(pi, 517, 0), ScalarInt::Max(pi, 517, 0));
+    EXPECT_EQ(Avx2Int::Sum(pi, 517), ScalarInt::Sum(pi, 517));
+    EXPECT_EQ(Avx2Float::Find(pf, 517, 3.25f),
+              ScalarFloat::Find(pf, 517, 3.25f));
+    EXPECT_EQ(Avx2Float::Count(pf, 517, -1.f),
+              ScalarFloat::Count(pf, 517, -1.f));
+    EXPECT_EQ(Avx2Float::Min(pf, 517, 0.f), ScalarFloat::Min(pf, 517, 0.f));
+    EXPECT_EQ(Avx2Float::Max(pf, 517, 0.f), ScalarFloat::Max(pf, 517, 0.f));
+    EXPECT_DOUBLE_EQ(Avx2Float::Sum(pf, 517), ScalarFloat::Sum(pf, 517));
+  }
+}
+#endif
+
+// VECTOR PARALLEL
+
+TEST(VectorParallelTest, Pool_runs_every_index_once) {
+  s21::parallel::thread_pool pool(3);
+  std::vector<std::atomic<int>> hits(1000);
+  pool.run(hits.size(), [&](std::size_t i) { hits[i]++; });
+  for (auto &hit : hits) EXPECT_EQ(hit.load(), 1);
+}
+
+TEST(VectorParallelTest, Pool_reuses_its_threads) {
+  s21::parallel::thread_pool pool(2);
+  std::mutex mutex;
+  std::set<std::thread::id> ids;
+  for (int round = 0; round < 20; round++)
+    pool.run(64, [&](std::size_t) {
+      std::this_thread::sleep_for(std::chrono::microseconds(50));
+      std::lock_guard<std::mutex> lock(mutex);
+      ids.insert(std::this_thread::get_id());
+    });
+  EXPECT_LE(ids.size(), pool.size() + 1);
+}
+
+TEST(VectorParallelTest, Pool_without_workers) {
+  s21::parallel::thread_pool pool(0);
+  std::size_t total = 0;
+  pool.run(10, [&](std::size_t i) { total += i; });
+  EXPECT_EQ(pool.size(), 0U);
+  EXPECT_EQ(total, 45U);
+}
+
+TEST(VectorParallelTest, Pool_rethrows_and_stays_usable) {
+  s21::parallel::thread_pool pool(3);
+  EXPECT_THROW(pool.run(100,
+                        [](std::size_t i) {
+                          if (i == 42) throw std::runtime_error("task");
+                        }),
+               std::runtime_error);
+  std::atomic<int> calls(0);
+  pool.run(100, [&](std::size_t) { calls++; });
+  EXPECT_EQ(calls.load(), 100);
+}
+
+TEST(VectorParallelTest, Pool_nested_run) {
+  s21::parallel::thread_pool pool(2);
+  std::atomic<int> calls(0);
+  pool.run(4, [&](std::size_t) {
+    pool.run(4, [&](std::size_t) { calls++; });
+  });
+  EXPECT_EQ(calls.load(), 16);
+}
+
+TEST(VectorParallelTest, Sort) {
+  s21::parallel::thread_pool pool(3);
+  s21::vector<int> s21_vector;
+  std::vector<int> std_vector;
+  for (int i = 0; i < 100000; i++) {
+    int value = static_cast<int>((i * 2654435761U) % 100003);
+    s21_vector.push_back(value);
+    std_vector.push_back(value);
+  }
+  s21::parallel::sort(pool, s21_vector);
+  std::sort(std_vector.begin(), std_vector.end());
+  EXPECT_TRUE(std::equal(std_vector.begin(), std_vector.end(),
+                         s21_vector.begin()));
+  s21::parallel::sort(pool, s21_vector, std::greater<int>());
+  EXPECT_TRUE(std::equal(std_vector.rbegin(), std_vector.rend(),
+                         s21_vector.begin()));
+}
+
+TEST(VectorParallelTest, Sort_small_and_shared_pool) {
+  s21::vector<int> s21_vector = {5, 3, 9, 1, 7};
+  s21::parallel::sort(s21_vector);
+  std::vector<int> expected = {1, 3, 5, 7, 9};
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                         s21_vector.begin()));
+  s21::vector<int> empty;
+  s21::parallel::sort(empty);
+  EXPECT_TRUE(empty.empty());
+}
+
+TEST(VectorParallelTest, For_each_and_transform) {
+  s21::parallel::thread_pool pool(3);
+  s21::vector<int> s21_vector;
+  for (int i = 0; i < 50000; i++) s21_vector.push_back(i);
+  s21::parallel::for_each(pool, s21_vector, [](int &x) { x *= 2; });
+  s21::vector<double> halves;
+  s21::parallel::transform(pool, s21_vector, halves,
+                           [](int x) { return x / 4.0; });
+  EXPECT_EQ(halves.size(), s21_vector.size());
+  for (int i = 0; i < 50000; i++) {
+    EXPECT_EQ(s21_vector[i], 2 * i);
+    EXPECT_DOUBLE_EQ(halves[i], i / 2.0);
+  }
+  s21::parallel::transform(pool, s21_vector, s21_vector,
+                           [](int x) { return x + 1; });
+  EXPECT_EQ(s21_vector[49999], 99999);
+}
+
+TEST(VectorParallelTest, Reduce) {
+  s21::parallel::thread_pool pool(3);
+  s21::vector<long long> numbers;
+  for (long long i = 1; i <= 100000; i++) numbers.push_back(i);
+  EXPECT_EQ(s21::parallel::reduce(pool, numbers, 10LL), 5000050010LL);
+  s21::vector<long long> empty;
+  EXPECT_EQ(s21::parallel::reduce(pool, empty, 7LL), 7LL);
+}
+
+TEST(VectorParallelTest, Reduce_keeps_order) {
+  s21::parallel::thread_pool pool(3);
+  s21::vector<std::string> letters;
+  std::string expected = ">";
+  for (int i = 0; i < 20000; i++) {
+    letters.push_back(std::string(1, static_cast<char>('a' + i % 26)));
+    expected += letters[i];
+  }
+  EXPECT_EQ(s21::parallel::reduce(pool, letters, std::string(">")),
+            expected);
+}
+
+TEST(VectorParallelTest, Inclusive_scan) {
+  s21::parallel::thread_pool pool(3);
+  s21::vector<long long> numbers;
+  std::vector<long long> expected;
+  for (long long i = 0; i < 30001; i++) {
+    numbers.push_back(i % 7 - 3);
+    expected.push_back(i % 7 - 3);
+  }
+  std::partial_sum(expected.begin(), expected.end(), expected.begin());
+  s21::vector<long long> prefix;
+  s21::parallel::inclusive_scan(pool, numbers, prefix);
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), prefix.begin()));
+  s21::parallel::inclusive_scan(pool, numbers, numbers);
+  EXPECT_TRUE(std::equal(expected.begin(), expected.end(), numbers.begin()));
+  s21::vector<long long> maxima;
+  s21::parallel::inclusive_scan(
+      pool, s21::vector<long long>{1, 5, 2, 8, 3}, maxima,
+      [](long long a, long long b) { return std::max(a, b); });
+  std::vector<long long> expected_maxima = {1, 5, 5, 8, 8};
+  EXPECT_TRUE(std::equal(expected_maxima.begin(), expected_maxima.end(),
+                         maxima.begin()));
+}
+
+// PACKED INT VECTOR
+
+std::vector<std::uint64_t> SortedIds(std::size_t n) {
+  std::vector<std::uint64_t> ids(n);
+  std::uint64_t id = 1ull << 40;
+  for (std::size_t i = 0; i < n; i++) ids[i] = id += (i * 7919) % 1000 + 1;
+  return ids;
+}
+
+TEST(PackedIntVectorTest, Round_trip_both_encodings) {
+  std::vector<std::uint64_t> ids = SortedIds(1000);
+  for (auto encoding : {s21::packed_encoding::frame_of_reference,
+                        s21::packed_encoding::delta}) {
+    s21::packed_int_vector packed(ids.begin(), ids.end(), encoding);
+    ASSERT_EQ(packed.size(), ids.size());
+    EXPECT_EQ(packed.block_count(), 1000 / 128);
+    for (std::size_t i = 0; i < ids.size(); i++) EXPECT_EQ(packed[i], ids[i]);
+    EXPECT_TRUE(std::equal(packed.begin(), packed.end(), ids.begin()));
+    EXPECT_EQ(packed.front(), ids.front());
+    EXPECT_EQ(packed.back(), ids.back());
+    EXPECT_THROW(packed.at(1000), std::out_of_range);
+  }
+}
+
+TEST(PackedIntVectorTest, Unsorted_and_extreme_values) {
+  std::vector<std::uint64_t> values;
+  for (std::uint64_t i = 0; i < 700; i++)
+    values.push_back(i % 3 == 0 ? ~0ull - i : i * 0x9E3779B97F4A7C15ull);
+  for (auto encoding : {s21::packed_encoding::frame_of_reference,
+                        s21::packed_encoding::delta}) {
+    s21::packed_int_vector packed(values.begin(), values.end(), encoding);
+    EXPECT_TRUE(std::equal(packed.begin(), packed.end(), values.begin()));
+    EXPECT_EQ(packed.at(699), values[699]);
+  }
+  std::vector<std::uint64_t> same(300, 42);
+  s21::packed_int_vector constant(same.begin(), same.end(),
+                                  s21::packed_encoding::delta);
+  // Equal values pack to zero bits; only the block headers remain.
+  EXPECT_LT(constant.memory_usage(), sizeof(constant) + 128);
+  EXPECT_TRUE(std::equal(constant.begin(), constant.end(), same.begin()));
+}
+
+TEST(PackedIntVectorTest, Delta_compresses_sorted_ids) {
+  std::vector<std::uint64_t> ids = SortedIds(100000);
+  s21::packed_int_vector packed(ids.begin(), ids.end(),
+                                s21::packed_encoding::delta);
+  packed.shrink_to_fit();
+  s21::vector<std::uint64_t> plain(ids.begin(), ids.end());
+  // Gaps below 1001 need 10 bits, plus the per-block header.
+  EXPECT_LT(packed.memory_usage(), plain.size() * sizeof(std::uint64_t) / 4);
+  std::uint64_t sum = 0;
+  for (std::uint64_t id : packed) sum += id;
+  EXPECT_EQ(sum, std::accumulate(ids.begin(), ids.end(), std::uint64_t(0)));
+}
+
+TEST(PackedIntVectorTest, Copy_move_swap_clear) {
+  std::vector<std::uint64_t> ids = SortedIds(300);
+  s21::packed_int_vector packed(ids.begin(), ids.end());
+  s21::packed_int_vector copy(packed);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), ids.begin()));
+  s21::packed_int_vector moved(std::move(copy));
+  EXPECT_TRUE(copy.empty());
+  EXPECT_EQ(moved.size(), 300);
+  s21::packed_int_vector other = {1, 2};
+  other.swap(moved);
+  EXPECT_EQ(moved.size(), 2);
+  EXPECT_EQ(other[299], ids[299]);
+  other.clear();
+  EXPECT_TRUE(other.empty());
+  other.push_back(7);
+  EXPECT_EQ(other.back(), 7);
+}
+
+TEST(PackedIntVectorTest, Unpack_kernels_agree_at_every_width) {
+  std::vector<std::uint64_t> words(130);
+  for (std::size_t i = 0; i < words.size(); i++)
+    words[i] = (i + 1) * 0x9E3779B97F4A7C15ull;
+  for (unsigned width = 0; width <= 64; width++) {
+    std::uint64_t expected[128], actual[128];
+    s21::simd::ScalarUnpackKernel::Unpack(words.data(), width, 3, expected);
+    std::uint64_t mask = width == 64 ? ~0ull : (1ull << width) - 1;
+    EXPECT_EQ(expected[0], (words[0] & mask) + 3);
+#ifdef S21_SIMD_X86
+    if (s21::simd::HasAvx2()) {
+      s21::simd::Avx2UnpackKernel::Unpack(words.data(), width, 3, actual);
+      EXPECT_TRUE(std::equal(actual, actual + 128, expected)) << width;
+    }
+#endif
+    static_cast<void>(actual);
+  }
+}
+
+// SMALL VECTOR
+
+TEST(SmallVectorTest, Inline_no_allocations) {
+  CountingAllocator<int>::allocations = 0;
+  s21::small_vector<int, 8, CountingAllocator<int>> s21_v;
+  for (int i = 0; i < 7; i++) s21_v.push_back(i);
+  s21_v.insert(s21_v.begin(), 10);
+  s21_v.erase(s21_v.begin() + 3);
+  s21_v.pop_back();
+  s21_v.emplace(s21_v.begin() + 1, 11);
+  EXPECT_EQ(CountingAllocator<int>::allocations, 0);
+  EXPECT_TRUE(s21_v.is_inline());
+  EXPECT_EQ(s21_v.capacity(), 8);
+  std::vector<int> expected{10, 11, 0, 1, 3, 4, 5};
+  ASSERT_EQ(s21_v.size(), expected.size());
+  for (std::size_t i = 0; i < expected.size(); i++)
+    EXPECT_EQ(s21_v[i], expected[i]);
+}
+
+TEST(SmallVectorTest, Spill_to_heap) {
+  CountingAllocator<std::string>::allocations = 0;
+  s21::small_vector<std::string, 4, CountingAllocator<std::string>> s21_v;
+  std::vector<std::string> std_v;
+  for (int i = 0; i < 20; i++) {
+    s21_v.push_back(std::to_string(i));
+    std_v.push_back(std::to_string(i));
+  }
+  EXPECT_FALSE(s21_v.is_inline());
+  EXPECT_EQ(CountingAllocator<std::string>::allocations, 3);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  for (std::size_t i = 0; i < std_v.size(); i++) EXPECT_EQ(s21_v[i], std_v[i]);
+
+  while (s21_v.size() > 3) s21_v.pop_back();
+  s21_v.shrink_to_fit();
+  EXPECT_TRUE(s21_v.is_inline());
+  EXPECT_EQ(s21_v.capacity(), 4);
+  EXPECT_EQ(s21_v.back(), "2");
+}
+
+TEST(SmallVectorTest, Constructors) {
+  s21::small_vector<int, 4> s21_v1{1, 2, 3};
+  s21::small_vector<int, 4> s21_v2(s21_v1);
+  s21::small_vector<int, 4> s21_v3(6);
+  std::list<int> source{4, 5, 6, 7, 8};
+  s21::small_vector<int, 4> s21_v4(source.begin(), source.end());
+  EXPECT_EQ(s21_v2.size(), 3);
+  EXPECT_EQ(s21_v2.at(2), 3);
+  EXPECT_EQ(s21_v3.size(), 6);
+  EXPECT_EQ(s21_v3[5], 0);
+  EXPECT_EQ(s21_v4.size(), 5);
+  EXPECT_EQ(s21_v4.front(), 4);
+  EXPECT_EQ(s21_v4.back(), 8);
+  EXPECT_ANY_THROW(s21_v1.at(3));
+}
+
+TEST(SmallVectorTest, Move) {
+  s21::small_vector<std::string, 2> inline_v{"a", "b"};
+  s21::small_vector<std::string, 2> heap_v{"c", "d", "e"};
+  s21::small_vector<std::string, 2> moved_inline(std::move(inline_v));
+  s21::small_vector<std::string, 2> moved_heap(std::move(heap_v));
+  EXPECT_TRUE(inline_v.empty());
+  EXPECT_TRUE(heap_v.empty());
+  EXPECT_TRUE(heap_v.is_inline());
+  EXPECT_EQ(moved_inline[1], "b");
+  EXPECT_EQ(moved_heap[2], "e");
+  moved_inline = std::move(moved_heap);
+  EXPECT_EQ(moved_inline.size(), 3);
+  EXPECT_EQ(moved_inline[0], "c");
+}
+
+TEST(SmallVectorTest, Move_inline_relocatable) {
+  RelocatableCounter::moves = RelocatableCounter::destroyed = 0;
+  {
+    s21::small_vector<RelocatableCounter, 4> s21_v1;
+    s21::small_vector<RelocatableCounter, 4> s21_v2;
+    for (int i = 0; i < 3; i++) s21_v1.emplace_back(i);
+    for (int i = 3; i < 5; i++) s21_v2.emplace_back(i);
+    s21::small_vector<RelocatableCounter, 4> moved(std::move(s21_v1));
+    moved.swap(s21_v2);
+    s21_v1 = std::move(moved);
+    EXPECT_EQ(RelocatableCounter::destroyed, 0);
+    EXPECT_EQ(RelocatableCounter::moves, 0);
+    ASSERT_EQ(s21_v1.size(), 2);
+    ASSERT_EQ(s21_v2.size(), 3);
+    EXPECT_EQ(*s21_v1[1].value, 4);
+    EXPECT_EQ(*s21_v2[2].value, 2);
+  }
+  EXPECT_EQ(RelocatableCounter::destroyed, 5);
+}
+
+TEST(SmallVectorTest, Swap) {
+  s21::small_vector<int, 3> s21_v1{1, 2};
+  s21::small_vector<int, 3> s21_v2{3, 4, 5, 6, 7};
+  s21_v1.swap(s21_v2);
+  EXPECT_EQ(s21_v1.size(), 5);
+  EXPECT_EQ(s21_v2.size(), 2);
+  EXPECT_EQ(s21_v1[4], 7);
+  EXPECT_EQ(s21_v2[1], 2);
+  EXPECT_TRUE(s21_v2.is_inline());
+}
+
+TEST(SmallVectorTest, Range_insert_and_iterators) {
+  s21::small_vector<int, 4> s21_v{1, 5};
+  std::vector<int> source{2, 3, 4};
+  s21_v.insert(s21_v.begin() + 1, source.begin(), source.end());
+  s21_v.insert(s21_v.end(), 2, 6);
+  s21_v.append_range(source);
+  std::vector<int> expected{1, 2, 3, 4, 5, 6, 6, 2, 3, 4};
+  ASSERT_EQ(s21_v.size(), expected.size());
+  EXPECT_TRUE(std::equal(s21_v.begin(), s21_v.end(), expected.begin()));
+  std::sort(s21_v.begin(), s21_v.end());
+  EXPECT_TRUE(std::is_sorted(s21_v.cbegin(), s21_v.cend()));
+}
+
+TEST(SmallVectorTest, Resize) {
+  s21::small_vector<int, 4> s21_v(2, 3);
+  EXPECT_TRUE(s21_v.is_inline());
+  s21_v.resize(4);
+  EXPECT_TRUE(s21_v.is_inline());
+  EXPECT_EQ(s21_v[3], 0);
+  s21_v.resize(9, 1);
+  EXPECT_FALSE(s21_v.is_inline());
+  std::vector<int> expected{3, 3, 0, 0, 1, 1, 1, 1, 1};
+  ASSERT_EQ(s21_v.size(), expected.size());
+  EXPECT_TRUE(std::equal(s21_v.begin(), s21_v.end(), expected.begin()));
+  s21_v.resize(1);
+  s21_v.resize_default_init(3);
+  EXPECT_EQ(s21_v.size(), 3);
+  EXPECT_EQ(s21_v[0], 3);
+  s21::small_vector<std::string, 2> strings(5, s21::default_init);
+  EXPECT_EQ(strings.size(), 5);
+  EXPECT_TRUE(strings[4].empty());
+}
+
+// MMAP VECTOR
+
+std::string MmapTestPath(const std::string &name) {
+  std::string path = testing::TempDir() + "s21_mmap_vector_" + name;
+  std::remove(path.c_str());
+  return path;
+}
+
+TEST(MmapVectorTest, Write_and_reopen) {
+  std::string path = MmapTestPath("reopen");
+  {
+    s21::mmap_vector<long long> s21_v(path);
+    EXPECT_TRUE(s21_v.empty());
+    for (long long i = 0; i < 100000; i++) s21_v.push_back(i * 3);
+    EXPECT_GE(s21_v.capacity(), s21_v.size());
+    s21_v.sync();
+  }
+  std::ifstream file(path, std::ios::binary | std::ios::ate);
+  EXPECT_EQ(static_cast<std::size_t>(file.tellg()),
+            100000 * sizeof(long long));
+  s21::mmap_vector<long long> s21_v(path);
+  ASSERT_EQ(s21_v.size(), 100000);
+  EXPECT_EQ(s21_v.capacity(), 100000);
+  EXPECT_EQ(s21_v[99999], 299997);
+  s21_v.push_back(-1);
+  EXPECT_EQ(s21_v.back(), -1);
+  std::remove(path.c_str());
+}
+
+TEST(MmapVectorTest, Read_only) {
+  std::string path = MmapTestPath("read_only");
+  {
+    s21::mmap_vector<int> s21_v(path);
+    s21_v.append_range(std::vector<int>{1, 2, 3, 4});
+  }
+  s21::mmap_vector<int> s21_v(path, s21::mmap_mode::read_only);
+  EXPECT_TRUE(s21_v.read_only());
+  ASSERT_EQ(s21_v.size(), 4);
+  EXPECT_EQ(s21_v.front(), 1);
+  EXPECT_EQ(std::accumulate(s21_v.cbegin(), s21_v.cend(), 0), 10);
+  EXPECT_THROW(s21_v.push_back(5), std::logic_error);
+  EXPECT_THROW(s21_v.pop_back(), std::logic_error);
+  EXPECT_THROW(s21_v.erase(s21_v.begin()), std::logic_error);
+  EXPECT_EQ(s21_v.size(), 4);
+  EXPECT_THROW(s21::mmap_vector<int>(MmapTestPath("missing"),
+                                     s21::mmap_mode::read_only),
+               std::system_error);
+  std::remove(path.c_str());
+}
+
+TEST(MmapVectorTest, Modifiers) {
+  std::string path = MmapTestPath("modifiers");
+  s21::mmap_vector<int> s21_v(path);
+  std::vector<int> std_v;
+  s21_v.insert(s21_v.cend(), {1, 2, 3});
+  std_v.insert(std_v.cend(), {1, 2, 3});
+  s21_v.insert(s21_v.begin() + 1, 2, s21_v[2]);
+  std_v.insert(std_v.begin() + 1, 2, std_v[2]);
+  s21_v.emplace(s21_v.begin(), 7);
+  std_v.emplace(std_v.begin(), 7);
+  s21_v.erase(s21_v.begin() + 2);
+  std_v.erase(std_v.begin() + 2);
+  std::istringstream input("8 9");
+  s21_v.insert(s21_v.begin() + 1, std::istream_iterator<int>(input),
+               std::istream_iterator<int>());
+  std_v.insert(std_v.begin() + 1, {8, 9});
+  s21_v.resize(10);
+  std_v.resize(10);
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  EXPECT_TRUE(std::equal(std_v.begin(), std_v.end(), s21_v.begin()));
+  s21_v.resize(3);
+  s21_v.shrink_to_fit();
+  EXPECT_EQ(s21_v.capacity(), 3);
+  s21_v.clear();
+  EXPECT_TRUE(s21_v.empty());
+  EXPECT_THROW(s21_v.at(0), std::out_of_range);
+  std::remove(path.c_str());
+}
+
+TEST(MmapVectorTest, Resize_default_init_and_move) {
+  std::string path = MmapTestPath("move");
+  s21::mmap_vector<double> s21_v(path);
+  s21_v.resize_default_init(1 << 16);
+  EXPECT_EQ(s21_v.size(), 1U << 16);
+  EXPECT_EQ(s21_v[12345], 0.0);
+  s21_v[12345] = 1.5;
+  s21::mmap_vector<double> moved(std::move(s21_v));
+  EXPECT_TRUE(s21_v.empty());
+  EXPECT_EQ(moved[12345], 1.5);
+  std::remove(path.c_str());
+}
+
+TEST(MmapVectorTest, Bad_file_size) {
+  std::string path = MmapTestPath("bad_size");
+  std::ofstream(path, std::ios::binary) << "abc";
+  EXPECT_THROW(s21::mmap_vector<int>{path}, std::invalid_argument);
+  std::remove(path.c_str());
+}
+
+// SOA VECTOR
+
+TEST(SoaVectorTest, Push_back_and_rows) {
+  s21::soa_vector<int, double, std::string> s21_v;
+  s21_v.push_back(std::make_tuple(1, 1.5, std::string("one")));
+  std::tuple<int, double, std::string> row(2, 2.5, "two");
+  s21_v.push_back(row);
+  s21_v.emplace_back(3, 3.5, "three");
+  ASSERT_EQ(s21_v.size(), 3);
+  EXPECT_EQ(std::get<2>(s21_v[1]), "two");
+  EXPECT_EQ(std::get<0>(s21_v.back()), 3);
+  auto [id, price, name] = s21_v[0];
+  price = 10;
+  name += "!";
+  EXPECT_EQ(id, 1);
+  EXPECT_EQ(std::get<1>(s21_v.front()), 10);
+  EXPECT_EQ(std::get<2>(s21_v.at(0)), "one!");
+  EXPECT_THROW(s21_v.at(3), std::out_of_range);
+}
+
+TEST(SoaVectorTest, Columns) {
+  s21::soa_vector<int, long long> s21_v;
+  for (int i = 0; i < 1000; i++) s21_v.emplace_back(i, 2LL * i);
+  s21::span<long long> totals = s21_v.column<1>();
+  ASSERT_EQ(totals.size(), 1000);
+  EXPECT_EQ(std::accumulate(totals.begin(), totals.end(), 0LL), 999000LL);
+  for (auto &total : totals) total++;
+  const auto &view = s21_v;
+  s21::span<const int> ids = view.column<0>();
+  EXPECT_EQ(ids.data() + 1, &std::get<0>(s21_v[1]));
+  EXPECT_EQ(ids[999], 999);
+  EXPECT_EQ(std::get<1>(view[999]), 1999);
+  EXPECT_GE(s21_v.capacity(), s21_v.size());
+}
+
+TEST(SoaVectorTest, Iterators) {
+  s21::soa_vector<int, char> s21_v{{1, 'a'}, {2, 'b'}, {3, 'c'}};
+  for (auto row : s21_v) std::get<0>(row) *= 10;
+  std::string letters;
+  int sum = 0;
+  for (auto it = s21_v.cbegin(); it != s21_v.cend(); ++it) {
+    sum += std::get<0>(*it);
+    letters += std::get<1>(*it);
+  }
+  EXPECT_EQ(sum, 60);
+  EXPECT_EQ(letters, "abc");
+  s21::soa_vector<int, char>::const_iterator it = s21_v.begin() + 2;
+  EXPECT_EQ(it - s21_v.cbegin(), 2);
+  EXPECT_EQ(std::get<1>(it[-1]), 'b');
+  auto found = std::find_if(s21_v.begin(), s21_v.end(), [](auto row) {
+    return std::get<1>(row) == 'c';
+  });
+  EXPECT_EQ(found.index(), 2);
+}
+
+TEST(SoaVectorTest, Modifiers) {
+  s21::soa_vector<int, std::string> s21_v{{1, "a"}, {2, "b"}, {3, "c"}};
+  s21_v.erase(s21_v.begin() + 1);
+  ASSERT_EQ(s21_v.size(), 2);
+  EXPECT_EQ(std::get<1>(s21_v[1]), "c");
+  s21_v.pop_back();
+  s21_v.resize(3);
+  EXPECT_EQ(std::get<0>(s21_v[2]), 0);
+  EXPECT_TRUE(std::get<1>(s21_v[2]).empty());
+  s21::soa_vector<int, std::string> other;
+  other.swap(s21_v);
+  EXPECT_TRUE(s21_v.empty());
+  EXPECT_EQ(other.size(), 3);
+  s21::soa_vector<int, std::string> copy(other);
+  other.clear();
+  EXPECT_EQ(std::get<1>(copy[0]), "a");
+  EXPECT_THROW(copy.erase(copy.end()), std::out_of_range);
+}
+
+struct ThrowOnCopy {
+  ThrowOnCopy() = default;
+  ThrowOnCopy(const ThrowOnCopy&) { throw std::runtime_error("copy"); }
+};
+
+TEST(SoaVectorTest, Push_back_rollback) {
+  s21::soa_vector<int, ThrowOnCopy> s21_v;
+  s21_v.resize(2);
+  std::tuple<int, ThrowOnCopy> row;
+  EXPECT_THROW(s21_v.push_back(row), std::runtime_error);
+  EXPECT_EQ(s21_v.size(), 2);
+  EXPECT_EQ(s21_v.column<0>().size(), 2);
+  EXPECT_EQ(s21_v.column<1>().size(), 2);
+}
+
+struct ThrowWhenArmed {
+  static inline bool armed = false;
+
+  ThrowWhenArmed() {
+    if (armed) throw std::runtime_error("construct");
+  }
+  ThrowWhenArmed(const ThrowWhenArmed&) = default;
+  ThrowWhenArmed& operator=(const ThrowWhenArmed&) {
+    if (armed) throw std::runtime_error("assign");
+    return *this;
+  }
+};
+
+TEST(SoaVectorTest, Resize_and_erase_rollback) {
+  s21::soa_vector<int, ThrowWhenArmed> s21_v;
+  s21_v.resize(3);
+  ThrowWhenArmed::armed = true;
+  EXPECT_THROW(s21_v.resize(10), std::runtime_error);
+  EXPECT_EQ(s21_v.size(), 3);
+  EXPECT_EQ(s21_v.column<0>().size(), 3);
+  EXPECT_EQ(s21_v.column<1>().size(), 3);
+  EXPECT_THROW(s21_v.erase(s21_v.begin()), std::runtime_error);
+  ThrowWhenArmed::armed = false;
+  EXPECT_EQ(s21_v.size(), 2);
+  EXPECT_EQ(s21_v.column<0>().size(), 2);
+  EXPECT_EQ(s21_v.column<1>().size(), 2);
+}
+
+// ALIGNED ALLOCATOR
+
+template <typename T>
+bool IsAligned(const T *p, std::size_t alignment) {
+  return reinterpret_cast<std::uintptr_t>(p) % alignment == 0;
+}
+
+TEST(AlignedAllocatorTest, Vector_data_alignment) {
+  s21::vector<float, s21::aligned_allocator<float, 64>> s21_v;
+  EXPECT_EQ(s21_v.data_alignment, 64);
+  EXPECT_EQ(s21::vector<double>::data_alignment, alignof(double));
+  for (int i = 0; i < 1000; i++) {
+    s21_v.push_back(static_cast<float>(i));
+    EXPECT_TRUE(IsAligned(s21_v.data(), 64));
+  }
+  s21_v.insert(s21_v.begin() + 3, 100, 0.5f);
+  s21_v.shrink_to_fit();
+  EXPECT_TRUE(IsAligned(s21_v.data(), 64));
+  EXPECT_EQ(s21_v[999 + 100], 999.0f);
+  EXPECT_FLOAT_EQ(s21::simd::sum(s21_v.data(), s21_v.size()), 499550.0f);
+}
+
+TEST(AlignedAllocatorTest, Page_alignment) {
+  s21::vector<char, s21::aligned_allocator<char, 4096>> s21_v(10);
+  EXPECT_TRUE(IsAligned(s21_v.data(), 4096));
+  s21::vector<bool, s21::aligned_allocator<bool, 4096>> bits(100);
+  bits.flip();
+  EXPECT_EQ(bits.count(), 100);
+}
+
+struct AlignedBlockLog {
+  static inline std::vector<const char *> blocks;
+};
+
+// aligned_allocator that records every block it hands out, whatever type
+// the container rebinds it to.
+template <typename T>
+struct RecordingAlignedAllocator : s21::aligned_allocator<T, 32>,
+                                   AlignedBlockLog {
+  template <typename U>
+  struct rebind {
+    using other = RecordingAlignedAllocator<U>;
+  };
+
+  RecordingAlignedAllocator() = default;
+
+  template <typename U>
+  RecordingAlignedAllocator(const RecordingAlignedAllocator<U> &) noexcept {}
+
+  T *allocate(std::size_t n) {
+    T *p = s21::aligned_allocator<T, 32>::allocate(n);
+    blocks.push_back(reinterpret_cast<const char *>(p));
+    return p;
+  }
+};
+
+TEST(AlignedAllocatorTest, List_rebind) {
+  using Alloc = s21::aligned_allocator<int, 32>;
+  using NodeAlloc = std::allocator_traits<Alloc>::rebind_alloc<double>;
+  EXPECT_TRUE((std::is_same<NodeAlloc,
+                            s21::aligned_allocator<double, 32>>::value));
+  AlignedBlockLog::blocks.clear();
+  s21::list<int, RecordingAlignedAllocator<int>> s21_list{1, 2, 3};
+  s21_list.push_front(0);
+  s21_list.push_back(4);
+  ASSERT_EQ(AlignedBlockLog::blocks.size(), 5);
+  for (const char *block : AlignedBlockLog::blocks)
+    EXPECT_TRUE(IsAligned(block, 32));
+  int expected = 0;
+  for (const int &value : s21_list) {
+    EXPECT_EQ(value, expected++);
+    const char *address = reinterpret_cast<const char *>(&value);
+    EXPECT_TRUE(std::any_of(
+        AlignedBlockLog::blocks.begin(), AlignedBlockLog::blocks.end(),
+        [&](const char *block) {
+          return address >= block && address < block + 32;
+        }));
+  }
+  EXPECT_EQ(expected, 5);
+}
+
+TEST(AlignedAllocatorTest, Huge_pages) {
+  using Alloc = s21::aligned_allocator<long long, 64, true>;
+  s21::vector<long long, Alloc> s21_v(Alloc::huge_page_size / 4);
+  EXPECT_TRUE(IsAligned(s21_v.data(), Alloc::huge_page_size));
+  s21_v[s21_v.size() - 1] = 7;
+  s21::vector<long long, Alloc> small(3);
+  EXPECT_TRUE(IsAligned(small.data(), 64));
+  EXPECT_EQ(s21_v.back(), 7);
+}
+
+// CONCURRENT VECTOR
+
+TEST(ConcurrentVectorTest, Push_back_and_access) {
+  s21::concurrent_vector<std::string> s21_v{"a", "b"};
+  auto it = s21_v.push_back("c");
+  EXPECT_EQ(it.index(), 2);
+  EXPECT_EQ(*it, "c");
+  EXPECT_EQ(s21_v.emplace_back(3, 'd'), "ddd");
+  ASSERT_EQ(s21_v.size(), 4);
+  EXPECT_EQ(s21_v[1], "b");
+  EXPECT_EQ(s21_v.at(3), "ddd");
+  EXPECT_THROW(s21_v.at(4), std::out_of_range);
+  std::string joined;
+  for (const auto &str : s21_v) joined += str;
+  EXPECT_EQ(joined, "abcddd");
+}
+
+TEST(ConcurrentVectorTest, Stable_addresses) {
+  s21::concurrent_vector<int> s21_v;
+  s21_v.push_back(42);
+  const int *first = &s21_v[0];
+  std::vector<const int *> addresses;
+  for (int i = 1; i < 10000; i++) addresses.push_back(&*s21_v.push_back(i));
+  EXPECT_EQ(first, &s21_v[0]);
+  EXPECT_EQ(*first, 42);
+  for (int i = 1; i < 10000; i++) {
+    EXPECT_EQ(addresses[i - 1], &s21_v[i]);
+    EXPECT_EQ(s21_v[i], i);
+  }
+  EXPECT_GE(s21_v.capacity(), s21_v.size());
+}
+
+TEST(ConcurrentVectorTest, Grow_by) {
+  s21::concurrent_vector<long long> s21_v;
+  s21_v.push_back(1);
+  auto it = s21_v.grow_by(100, 7);
+  EXPECT_EQ(it.index(), 1);
+  EXPECT_EQ(std::count(it, s21_v.end(), 7), 100);
+  auto zeros = s21_v.grow_by(5);
+  EXPECT_EQ(zeros - s21_v.begin(), 101);
+  EXPECT_EQ(std::accumulate(s21_v.cbegin(), s21_v.cend(), 0LL), 701);
+  s21_v.reserve(1000);
+  EXPECT_GE(s21_v.capacity(), 1000);
+  EXPECT_EQ(s21_v.size(), 106);
+}
+
+TEST(ConcurrentVectorTest, Concurrent_push_back) {
+  s21::concurrent_vector<int> s21_v;
+  const int threads = 8, per_thread = 20000;
+  std::vector<std::thread> workers;
+  for (int t = 0; t < threads; t++)
+    workers.emplace_back([&s21_v, t] {
+      for (int i = 0; i < per_thread; i++) {
+        if (i % 100 == 0)
+          s21_v.grow_by(3, -1);
+        else
+          s21_v.push_back(t * per_thread + i);
+      }
+    });
+  for (auto &worker : workers) worker.join();
+  // Every hundredth append is a grow_by of three slots instead of one.
+  ASSERT_EQ(s21_v.size(), threads * (per_thread + 2 * (per_thread / 100)));
+  std::vector<int> values;
+  for (std::size_t i = 0; i < s21_v.size(); i++) {
+    int value = s21_v.at(i);
+    if (value != -1) values.push_back(value);
+  }
+  std::sort(values.begin(), values.end());
+  std::vector<int> expected;
+  for (int t = 0; t < threads; t++)
+    for (int i = 0; i < per_thread; i++)
+      if (i % 100 != 0) expected.push_back(t * per_thread + i);
+  EXPECT_EQ(values, expected);
+}
+
+TEST(ConcurrentVectorTest, Constructor_throw_leaves_broken_slot) {
+  s21::concurrent_vector<ThrowOnCopy> s21_v;
+  ThrowOnCopy value;
+  s21_v.emplace_back();
+  EXPECT_THROW(s21_v.push_back(value), std::runtime_error);
+  EXPECT_EQ(s21_v.size(), 2);
+  EXPECT_NO_THROW(s21_v.at(0));
+  EXPECT_THROW(s21_v.at(1), std::out_of_range);
+}
+
+TEST(ConcurrentVectorTest, Copy_move_swap) {
+  s21::concurrent_vector<int> s21_v{1, 2, 3};
+  s21::concurrent_vector<int> copy(s21_v);
+  s21::concurrent_vector<int> moved(std::move(s21_v));
+  EXPECT_TRUE(s21_v.empty());
+  EXPECT_EQ(copy.size(), 3);
+  EXPECT_EQ(moved[2], 3);
+  copy.push_back(4);
+  moved.swap(copy);
+  EXPECT_EQ(moved.size(), 4);
+  EXPECT_EQ(copy.size(), 3);
+  s21_v = moved;
+  EXPECT_EQ(s21_v[3], 4);
+  s21_v.clear();
+  EXPECT_EQ(s21_v.capacity(), 0);
+}
+
+// STATIC VECTOR
+
+TEST(StaticVectorTest, Push_back_and_overflow) {
+  s21::static_vector<int, 4> s21_v;
+  EXPECT_EQ(s21_v.capacity(), 4);
+  for (int i = 0; i < 4; i++) s21_v.push_back(i);
+  EXPECT_TRUE(s21_v.full());
+  EXPECT_THROW(s21_v.push_back(4), std::length_error);
+  EXPECT_THROW(s21_v.reserve(5), std::length_error);
+  EXPECT_THROW(s21_v.resize(5), std::length_error);
+  EXPECT_THROW(s21_v.insert(s21_v.cbegin(), {7, 8}), std::length_error);
+  EXPECT_EQ(s21_v.size(), 4);
+  EXPECT_EQ(s21_v.back(), 3);
+  EXPECT_THROW((s21::static_vector<int, 2>{1, 2, 3}), std::length_error);
+}
+
+TEST(StaticVectorTest, Matches_std_vector) {
+  s21::static_vector<std::string, 32> s21_v = {"a", "b", "c"};
+  std::vector<std::string> std_v = {"a", "b", "c"};
+  s21_v.insert(s21_v.cbegin() + 1, "x");
+  std_v.insert(std_v.begin() + 1, "x");
+  s21_v.insert(s21_v.cend(), 3, "y");
+  std_v.insert(std_v.end(), 3, "y");
+  s21_v.emplace(s21_v.cbegin(), 2, 'z');
+  std_v.emplace(std_v.begin(), 2, 'z');
+  s21_v.erase(s21_v.begin() + 2);
+  std_v.erase(std_v.begin() + 2);
+  s21_v.erase(s21_v.cbegin() + 1, s21_v.cbegin() + 3);
+  std_v.erase(std_v.begin() + 1, std_v.begin() + 3);
+  s21_v.resize(10, "r");
+  std_v.resize(10, "r");
+  s21_v.pop_back();
+  std_v.pop_back();
+  ASSERT_EQ(s21_v.size(), std_v.size());
+  EXPECT_TRUE(std::equal(std_v.begin(), std_v.end(), s21_v.begin()));
+  EXPECT_EQ(s21::erase(s21_v, "y"), 3);
+  EXPECT_EQ(s21_v.size(), 6);
+}
+
+TEST(StaticVectorTest, Copy_move_swap) {
+  s21::static_vector<std::string, 8> s21_v1 = {"a", "b", "c"};
+  s21::static_vector<std::string, 8> s21_v2(s21_v1);
+  EXPECT_EQ(s21_v2.at(2), "c");
+  s21::static_vector<std::string, 8> s21_v3(std::move(s21_v1));
+  EXPECT_TRUE(s21_v1.empty());
+  EXPECT_EQ(s21_v3.size(), 3);
+  s21::static_vector<std::string, 8> s21_v4 = {"d"};
+  s21_v4.swap(s21_v3);
+  EXPECT_EQ(s21_v4.size(), 3);
+  EXPECT_EQ(s21_v3.size(), 1);
+  EXPECT_EQ(s21_v3.front(), "d");
+  s21_v3 = s21_v4;
+  EXPECT_EQ(s21_v3.back(), "c");
+  s21_v4 = std::move(s21_v2);
+  EXPECT_EQ(s21_v4.size(), 3);
+}
+
+TEST(StaticVectorTest, Copy_rollback) {
+  s21::static_vector<ThrowingCopy, 4> s21_v(3);
+  EXPECT_EQ(s21_v.size(), 3);
+  s21::static_vector<ThrowOnCopy, 4> s21_throwing(2);
+  EXPECT_THROW(s21_throwing.push_back(ThrowOnCopy()), std::runtime_error);
+  EXPECT_THROW(s21_throwing.insert(s21_throwing.cbegin(), ThrowOnCopy()),
+               std::runtime_error);
+  EXPECT_EQ(s21_throwing.size(), 2);
+}
+
+TEST(StaticVectorTest, Trivial_and_constexpr) {
+  using Trivial = s21::static_vector<int, 8>;
+  static_assert(std::is_trivially_copyable<Trivial>::value);
+  static_assert(!std::is_trivially_copyable<
+                s21::static_vector<std::string, 8>>::value);
+  constexpr auto squares = [] {
+    Trivial v;
+    for (int i = 1; i <= 5; i++) v.push_back(i * i);
+    v.pop_back();
+    return v;
+  }();
+  static_assert(squares.size() == 4 && squares[3] == 16);
+  Trivial copy = squares;
+  EXPECT_EQ(copy.back(), 16);
+}
+
+struct DefaultSeven {
+  DefaultSeven() : value(7) {}
+  explicit DefaultSeven(int v) : value(v) {}
+  int value;
+};
+
+TEST(StaticVectorTest, Trivially_copyable_non_trivial) {
+  using Vector = s21::static_vector<DefaultSeven, 4>;
+  static_assert(!std::is_trivial<DefaultSeven>::value);
+  static_assert(std::is_trivially_copyable<DefaultSeven>::value);
+  static_assert(std::is_trivially_copyable<Vector>::value);
+  Vector s21_v(2);
+  s21_v.emplace_back(3);
+  Vector copy = s21_v;
+  s21_v.clear();
+  ASSERT_EQ(copy.size(), 3);
+  EXPECT_EQ(copy[0].value, 7);
+  EXPECT_EQ(copy[2].value, 3);
+  copy.insert(copy.cbegin(), DefaultSeven(1));
+  EXPECT_EQ(copy.front().value, 1);
+  EXPECT_TRUE(copy.full());
+}
+
 // STACK
 
 TEST(StackTest, Constructor_default) {
@@ -1169,7 +2949,9 @@ TEST(ListTest, begin_3_throw) {
   s21::list<int> my_list1;
   std::list<int> std_list2;
 
-  EXPECT_EQ(*my_list1.begin(), *std_list2.begin());
+  // The sentinel holds no value, so begin() of an empty list is end().
+  EXPECT_EQ(my_list1.begin(), my_list1.end());
+  EXPECT_EQ(std_list2.begin(), std_list2.end());
 }
 
 TEST(ListTest, end_1) {
@@ -1245,6 +3027,51 @@ TEST(ListTest, Merge_6) {
   EXPECT_TRUE(compare_lists(my_list1, std_list1));
 }
 
+TEST(ListTest, Merge_relinks_without_allocating) {
+  using NodeAlloc = CountingAllocator<s21::Node<int>>;
+  s21::list<int, CountingAllocator<int>> my_list1{1, 4, 6};
+  s21::list<int, CountingAllocator<int>> my_list2{2, 3, 5, 7};
+  int* moved = &*++my_list2.begin();
+  NodeAlloc::allocations = 0;
+  my_list1.merge(my_list2);
+  EXPECT_EQ(NodeAlloc::allocations, 0);
+  EXPECT_EQ(&*++++my_list1.begin(), moved);
+  EXPECT_EQ(my_list1.size(), 7);
+  EXPECT_TRUE(my_list2.empty());
+  EXPECT_EQ(my_list2.begin(), my_list2.end());
+  int expected = 1;
+  for (int value : my_list1) EXPECT_EQ(value, expected++);
+  for (auto it = --my_list1.end(); it != my_list1.end(); --it)
+    EXPECT_EQ(*it, --expected);
+}
+
+TEST(ListTest, Merge_comparator_and_stable) {
+  using Item = std::pair<int, char>;
+  s21::list<Item> my_list1{{3, 'a'}, {2, 'a'}, {1, 'a'}};
+  s21::list<Item> my_list2{{3, 'b'}, {1, 'b'}, {0, 'b'}};
+  my_list1.merge(my_list2, [](const Item& lhs, const Item& rhs) {
+    return lhs.first > rhs.first;
+  });
+  std::list<Item> std_list1{{3, 'a'}, {3, 'b'}, {2, 'a'},
+                            {1, 'a'}, {1, 'b'}, {0, 'b'}};
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  EXPECT_TRUE(my_list2.empty());
+}
+
+TEST(ListTest, Merge_throwing_comparator_keeps_nodes) {
+  s21::list<int> my_list1{1, 3, 5};
+  s21::list<int> my_list2{2, 4, 6};
+  int calls = 0;
+  auto comp = [&calls](int lhs, int rhs) {
+    if (++calls == 3) throw std::runtime_error("compare");
+    return lhs < rhs;
+  };
+  EXPECT_THROW(my_list1.merge(my_list2, comp), std::runtime_error);
+  EXPECT_EQ(my_list1.size() + my_list2.size(), 6);
+  EXPECT_TRUE(compare_lists(my_list1, std::list<int>{1, 2, 3, 5}));
+  EXPECT_TRUE(compare_lists(my_list2, std::list<int>{4, 6}));
+}
+
 TEST(ListTest, Reverse_1) {
   s21::list<int> my_list{1, 2, 3, 4, 5};
   std::list<int> std_list{1, 2, 3, 4, 5};
@@ -1417,6 +3244,443 @@ TEST(ListTest, Erase_2) {
   EXPECT_TRUE(compare_lists(my_list1, std_list1));
 }
 
+TEST(ListTest, Erase_if_in_place) {
+  s21::list<int> my_list1;
+  std::list<int> std_list1;
+  for (int i = 0; i < 1000; i++) {
+    my_list1.push_back(i);
+    std_list1.push_back(i);
+  }
+  const int *kept = &*++my_list1.begin();
+  EXPECT_EQ(s21::erase_if(my_list1, [](int x) { return x % 2 == 0; }), 500U);
+  std_list1.remove_if([](int x) { return x % 2 == 0; });
+  EXPECT_EQ(&*my_list1.begin(), kept);
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  EXPECT_EQ(s21::erase(my_list1, 7), 1U);
+  std_list1.remove(7);
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  EXPECT_EQ(s21::erase(my_list1, 8), 0U);
+}
+
+TEST(ListTest, One_allocation_per_element) {
+  using NodeAlloc = CountingAllocator<s21::Node<std::string>>;
+  s21::list<std::string, CountingAllocator<std::string>> my_list1;
+  NodeAlloc::allocations = 0;
+  for (int i = 0; i < 100; i++) my_list1.push_back(std::to_string(i));
+  EXPECT_EQ(NodeAlloc::allocations, 100);
+  my_list1.pop_front();
+  my_list1.push_front("front");
+  EXPECT_EQ(my_list1.front(), "front");
+  EXPECT_EQ(my_list1.back(), "99");
+  EXPECT_EQ(my_list1.begin()->size(), 5);
+}
+
+TEST(ListTest, Throwing_copy_keeps_list) {
+  s21::list<ThrowOnCopy> my_list1;
+  ThrowOnCopy value;
+  EXPECT_THROW(my_list1.push_back(value), std::runtime_error);
+  EXPECT_THROW(my_list1.insert(my_list1.begin(), value), std::runtime_error);
+  EXPECT_TRUE(my_list1.empty());
+  EXPECT_EQ(my_list1.begin(), my_list1.end());
+}
+
+struct NoDefault {
+  explicit NoDefault(int v) : value(v) {}
+  int value;
+
+  friend bool operator<(const NoDefault& lhs, const NoDefault& rhs) {
+    return lhs.value < rhs.value;
+  }
+
+  friend bool operator==(const NoDefault& lhs, const NoDefault& rhs) {
+    return lhs.value == rhs.value;
+  }
+};
+
+TEST(ListTest, Empty_list_no_allocations) {
+  static_assert(
+      std::is_nothrow_default_constructible<s21::list<int>>::value, "");
+  using NodeAlloc = CountingAllocator<s21::Node<int>>;
+  NodeAlloc::allocations = 0;
+  s21::list<int, CountingAllocator<int>> my_list1;
+  s21::list<int, CountingAllocator<int>> my_list2(std::move(my_list1));
+  my_list2.clear();
+  my_list1.swap(my_list2);
+  EXPECT_EQ(NodeAlloc::allocations, 0);
+  EXPECT_EQ(my_list1.begin(), my_list1.end());
+}
+
+TEST(ListTest, Non_default_constructible) {
+  s21::list<NoDefault> my_list1;
+  my_list1.push_back(NoDefault(2));
+  my_list1.push_front(NoDefault(1));
+  EXPECT_EQ(my_list1.front().value, 1);
+  EXPECT_EQ(my_list1.back().value, 2);
+  EXPECT_EQ(my_list1.size(), 2);
+}
+
+TEST(ListTest, Swap_and_move_keep_iterators) {
+  s21::list<int> my_list1{1, 2, 3};
+  s21::list<int> my_list2;
+  auto it = my_list1.begin();
+  my_list1.swap(my_list2);
+  EXPECT_EQ(my_list1.begin(), my_list1.end());
+  EXPECT_EQ(*it, 1);
+  EXPECT_EQ(*--my_list2.end(), 3);
+  s21::list<int> my_list3;
+  {
+    s21::list<int> moved(std::move(my_list2));
+    my_list3.swap(moved);
+  }
+  int sum = 0;
+  for (; it != my_list3.end(); ++it) sum += *it;
+  EXPECT_EQ(sum, 6);
+  my_list2.push_back(4);
+  EXPECT_EQ(my_list2.front(), 4);
+}
+
+TEST(ListTest, Splice_and_merge_leave_other_usable) {
+  s21::list<int> my_list1{1, 3};
+  s21::list<int> my_list2{2, 4};
+  my_list1.splice(my_list1.cbegin(), my_list2);
+  EXPECT_TRUE(my_list2.empty());
+  EXPECT_EQ(my_list2.begin(), my_list2.end());
+  my_list2.push_back(5);
+  my_list2.push_front(0);
+  my_list1.sort();
+  my_list1.merge(my_list2);
+  EXPECT_TRUE(my_list2.empty());
+  my_list2.push_back(6);
+  EXPECT_EQ(my_list2.back(), 6);
+  EXPECT_TRUE(compare_lists(my_list1, std::list<int>{0, 1, 2, 3, 4, 5}));
+}
+
+TEST(ListTest, Sort) {
+  s21::list<int> my_list1{5, 1, 4, 1, 3, 9, 2, 6};
+  std::list<int> std_list1{5, 1, 4, 1, 3, 9, 2, 6};
+  my_list1.sort();
+  std_list1.sort();
+  EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  EXPECT_EQ(*--my_list1.end(), 9);
+  EXPECT_EQ(*++my_list1.end(), 1);
+}
+
+TEST(ListTest, Sort_empty_and_single) {
+  s21::list<int> my_list1;
+  my_list1.sort();
+  EXPECT_EQ(my_list1.begin(), my_list1.end());
+  my_list1.push_back(1);
+  my_list1.sort();
+  EXPECT_EQ(my_list1.front(), 1);
+  EXPECT_EQ(my_list1.back(), 1);
+}
+
+TEST(ListTest, Sort_comparator) {
+  s21::list<std::string> my_list1{"b", "d", "a", "c"};
+  my_list1.sort(std::greater<std::string>());
+  EXPECT_TRUE(
+      compare_lists(my_list1, std::list<std::string>{"d", "c", "b", "a"}));
+}
+
+TEST(ListTest, Sort_stable_and_relinks_nodes) {
+  s21::list<std::pair<int, int>> my_list1;
+  for (int i = 0; i < 100; i++) my_list1.push_back({i % 7, i});
+  auto it = my_list1.begin();
+  const std::pair<int, int>* first = &*it;
+  my_list1.sort([](const std::pair<int, int>& lhs,
+                   const std::pair<int, int>& rhs) {
+    return lhs.first < rhs.first;
+  });
+  EXPECT_EQ(&*it, first);
+  EXPECT_EQ(*it, std::make_pair(0, 0));
+  for (auto prev = my_list1.begin(), cur = ++my_list1.begin();
+       cur != my_list1.end(); ++prev, ++cur) {
+    EXPECT_TRUE(prev->first < cur->first ||
+                (prev->first == cur->first && prev->second < cur->second));
+  }
+}
+
+TEST(ListTest, Sort_large) {
+  for (int size : {1000, 100000}) {
+    s21::list<unsigned> my_list1;
+    std::list<unsigned> std_list1;
+    unsigned value = 1;
+    for (int i = 0; i < size; i++) {
+      value = value * 1103515245u + 12345u;
+      my_list1.push_back(value % 1000);
+      std_list1.push_back(value % 1000);
+    }
+    my_list1.sort();
+    std_list1.sort();
+    EXPECT_TRUE(compare_lists(my_list1, std_list1));
+  }
+}
+
+TEST(ListTest, Sort_throwing_comparator_keeps_nodes) {
+  s21::list<int> my_list1{9, 8, 7, 6, 5, 4, 3, 2, 1, 0};
+  int calls = 0;
+  auto comp = [&calls](int lhs, int rhs) {
+    if (++calls == 12) throw std::runtime_error("compare");
+    return lhs < rhs;
+  };
+  EXPECT_THROW(my_list1.sort(comp), std::runtime_error);
+  EXPECT_EQ(my_list1.size(), 10);
+  int sum = 0, count = 0;
+  for (auto it = my_list1.begin(); it != my_list1.end(); ++it, ++count)
+    sum += *it;
+  for (auto it = --my_list1.end(); it != my_list1.end(); --it) count--;
+  EXPECT_EQ(sum, 45);
+  EXPECT_EQ(count, 0);
+}
+
+// NODE POOL
+
+TEST(NodePoolTest, Reuses_freed_blocks) {
+  s21::node_pool pool(4);
+  void* first = pool.allocate(24, 8);
+  void* second = pool.allocate(20, 4);
+  EXPECT_EQ(pool.block_size(), 24);
+  EXPECT_EQ(pool.chunk_count(), 1);
+  EXPECT_EQ(pool.free_count(), 2);
+  EXPECT_EQ(pool.allocate(32, 8), nullptr);
+  pool.deallocate(first);
+  EXPECT_EQ(pool.allocate(24, 8), first);
+  pool.reserve(10, 24, 8);
+  EXPECT_EQ(pool.free_count(), 10);
+  EXPECT_EQ(pool.chunk_count(), 2);
+  pool.deallocate(first);
+  pool.deallocate(second);
+  EXPECT_EQ(pool.free_count(), 12);
+}
+
+TEST(NodePoolTest, Steady_state_push_pop_without_allocations) {
+  s21::list<int, s21::node_allocator<int>> my_list1;
+  my_list1.reserve_nodes(100);
+  auto pool = my_list1.get_allocator().pool();
+  ASSERT_NE(pool, nullptr);
+  EXPECT_EQ(pool->chunk_count(), 1);
+  EXPECT_EQ(pool->free_count(), 100);
+  long long sum = 0;
+  for (int i = 0; i < 1000000; i++) {
+    my_list1.push_back(i);
+    if (my_list1.size() > 64) {
+      sum += my_list1.front();
+      my_list1.pop_front();
+    }
+  }
+  EXPECT_EQ(pool->chunk_count(), 1);
+  EXPECT_EQ(pool->free_count(), 100 - 64);
+  EXPECT_EQ(sum, (1000000LL - 64) * (1000000LL - 65) / 2);
+}
+
+TEST(NodePoolTest, Shared_pool_across_lists) {
+  auto pool = std::make_shared<s21::node_pool>(16);
+  s21::node_allocator<std::string> alloc(pool);
+  s21::list<std::string, s21::node_allocator<std::string>> my_list1(alloc);
+  s21::list<std::string, s21::node_allocator<std::string>> my_list2(alloc);
+  for (int i = 0; i < 16; i++) my_list1.push_back(std::to_string(i));
+  my_list1.clear();
+  for (int i = 0; i < 16; i++) my_list2.push_back(std::to_string(i));
+  EXPECT_EQ(pool->chunk_count(), 1);
+  my_list1.push_back("x");
+  my_list1.splice(my_list1.cbegin(), my_list2);
+  my_list1.sort();
+  EXPECT_EQ(my_list1.size(), 17);
+  EXPECT_EQ(my_list1.back(), "x");
+  EXPECT_TRUE(my_list1.get_allocator() == my_list2.get_allocator());
+}
+
+TEST(NodePoolTest, Allocator_copies_share_the_pool_before_first_use) {
+  using List = s21::list<int, s21::node_allocator<int>>;
+  List my_list1;
+  List my_list2(my_list1.get_allocator());
+  EXPECT_TRUE(my_list1.get_allocator() == my_list2.get_allocator());
+  my_list1.push_back(1);
+  my_list2.push_back(2);
+  EXPECT_TRUE(my_list1.get_allocator() == my_list2.get_allocator());
+  {
+    List my_list3{3, 4};
+    EXPECT_FALSE(my_list1.get_allocator() == my_list3.get_allocator());
+    my_list1.splice(my_list1.cend(), my_list2);
+    my_list1.splice(my_list1.cend(), my_list3);
+    EXPECT_TRUE(my_list3.empty());
+  }
+  List my_list4{0, 5};
+  my_list1.merge(my_list4);
+  EXPECT_TRUE(my_list4.empty());
+  int expected[] = {0, 1, 2, 3, 4, 5};
+  ASSERT_EQ(my_list1.size(), 6);
+  int i = 0;
+  for (int value : my_list1) EXPECT_EQ(value, expected[i++]);
+  my_list1.clear();
+}
+
+TEST(NodePoolTest, Swap_move_and_copy_carry_the_pool) {
+  using List = s21::list<int, s21::node_allocator<int>>;
+  List my_list2{4, 5};
+  {
+    List my_list1{1, 2, 3};
+    my_list1.swap(my_list2);
+  }
+  EXPECT_EQ(my_list2.size(), 3);
+  EXPECT_EQ(my_list2.front(), 1);
+  EXPECT_EQ(my_list2.back(), 3);
+  List my_list3;
+  my_list3.push_back(7);
+  my_list3 = std::move(my_list2);
+  List my_list4(my_list3);
+  EXPECT_TRUE(my_list4.get_allocator() == my_list3.get_allocator());
+  my_list3.clear();
+  my_list4.push_back(4);
+  EXPECT_EQ(my_list4.size(), 4);
+  EXPECT_EQ(my_list4.back(), 4);
+  s21::list<int> my_list5;
+  my_list5.reserve_nodes(10);
+  EXPECT_TRUE(my_list5.empty());
+}
+
+// INTRUSIVE LIST
+
+struct LruEntry {
+  explicit LruEntry(int k) : key(k) {}
+  int key;
+  s21::list_hook hook;
+};
+
+using LruList = s21::intrusive_list<LruEntry, &LruEntry::hook>;
+
+std::vector<int> lru_keys(const LruList& lru) {
+  std::vector<int> keys;
+  for (auto it = lru.cbegin(); it != lru.cend(); ++it) keys.push_back(it->key);
+  return keys;
+}
+
+TEST(IntrusiveListTest, Push_pop_and_iterate) {
+  std::vector<LruEntry> entries{LruEntry(1), LruEntry(2), LruEntry(3)};
+  LruList lru;
+  EXPECT_TRUE(lru.empty());
+  EXPECT_EQ(lru.begin(), lru.end());
+  for (auto& entry : entries) lru.push_back(entry);
+  EXPECT_EQ(lru.size(), 3);
+  EXPECT_EQ(&lru.front(), &entries[0]);
+  EXPECT_EQ(lru.back().key, 3);
+  EXPECT_EQ((--lru.end())->key, 3);
+  EXPECT_TRUE(entries[1].hook.is_linked());
+  lru.pop_front();
+  lru.pop_back();
+  EXPECT_FALSE(entries[0].hook.is_linked());
+  EXPECT_EQ(lru_keys(lru), (std::vector<int>{2}));
+  lru.clear();
+  EXPECT_FALSE(entries[1].hook.is_linked());
+  EXPECT_TRUE(lru.empty());
+  EXPECT_THROW(lru.front(), std::out_of_range);
+  EXPECT_THROW(std::as_const(lru).back(), std::out_of_range);
+}
+
+TEST(IntrusiveListTest, Unlink_from_anywhere) {
+  std::vector<LruEntry> entries;
+  for (int i = 0; i < 5; i++) entries.emplace_back(i);
+  LruList lru;
+  for (auto& entry : entries) lru.push_back(entry);
+  lru.unlink(entries[2]);
+  lru.unlink(entries[0]);
+  lru.unlink(entries[4]);
+  EXPECT_EQ(lru_keys(lru), (std::vector<int>{1, 3}));
+  EXPECT_FALSE(entries[2].hook.is_linked());
+  auto it = lru.insert(lru.iterator_to(entries[3]), entries[2]);
+  EXPECT_EQ(it->key, 2);
+  it = lru.erase(lru.iterator_to(entries[1]));
+  EXPECT_EQ(&*it, &entries[2]);
+  EXPECT_EQ(lru_keys(lru), (std::vector<int>{2, 3}));
+  EXPECT_EQ(lru.size(), 2);
+}
+
+struct PolymorphicEntry {
+  explicit PolymorphicEntry(std::string n) : name(std::move(n)) {}
+  virtual ~PolymorphicEntry() = default;
+  std::string name;
+  s21::list_hook hook;
+};
+
+struct DerivedEntry : PolymorphicEntry {
+  explicit DerivedEntry(std::string n) : PolymorphicEntry(std::move(n)) {}
+  int extra = 0;
+};
+
+TEST(IntrusiveListTest, Non_standard_layout_owner) {
+  static_assert(!std::is_standard_layout<PolymorphicEntry>::value, "");
+  static_assert(
+      std::is_same<s21::list<int>::iterator,
+                   s21::ListIterator<s21::list<int>>>::value, "");
+  PolymorphicEntry first("first");
+  DerivedEntry second("second");
+  s21::intrusive_list<PolymorphicEntry, &PolymorphicEntry::hook> entries;
+  entries.push_back(first);
+  entries.push_back(second);
+  EXPECT_EQ(&entries.back(), static_cast<PolymorphicEntry*>(&second));
+  EXPECT_EQ(entries.begin()->name, "first");
+  EXPECT_EQ((++entries.cbegin())->name, "second");
+}
+
+TEST(IntrusiveListTest, Copy_starts_unlinked) {
+  LruEntry entry(1);
+  LruList lru;
+  lru.push_back(entry);
+  LruEntry copy(entry);
+  EXPECT_TRUE(entry.hook.is_linked());
+  EXPECT_FALSE(copy.hook.is_linked());
+  copy = entry;
+  EXPECT_FALSE(copy.hook.is_linked());
+}
+
+TEST(IntrusiveListTest, Splice_swap_and_move) {
+  std::vector<LruEntry> entries;
+  for (int i = 0; i < 6; i++) entries.emplace_back(i);
+  LruList lru1, lru2;
+  for (int i = 0; i < 3; i++) lru1.push_back(entries[i]);
+  for (int i = 3; i < 6; i++) lru2.push_back(entries[i]);
+  lru1.splice(++lru1.cbegin(), lru2);
+  EXPECT_TRUE(lru2.empty());
+  EXPECT_EQ(lru_keys(lru1), (std::vector<int>{0, 3, 4, 5, 1, 2}));
+  lru2.splice(lru2.cend(), lru1, lru1.iterator_to(entries[4]));
+  EXPECT_EQ(lru1.size(), 5);
+  EXPECT_EQ(lru_keys(lru2), (std::vector<int>{4}));
+  lru1.swap(lru2);
+  EXPECT_EQ(lru_keys(lru1), (std::vector<int>{4}));
+  LruList lru3(std::move(lru2));
+  EXPECT_TRUE(lru2.empty());
+  EXPECT_EQ(lru_keys(lru3), (std::vector<int>{0, 3, 5, 1, 2}));
+  lru2 = std::move(lru3);
+  EXPECT_EQ(lru2.size(), 5);
+  EXPECT_EQ(lru2.back().key, 2);
+}
+
+TEST(IntrusiveListTest, Lru_move_to_front_matches_list) {
+  const int capacity = 64;
+  std::vector<LruEntry> entries;
+  for (int i = 0; i < capacity; i++) entries.emplace_back(i);
+  LruList lru;
+  s21::list<int> reference;
+  for (auto& entry : entries) {
+    lru.push_back(entry);
+    reference.push_back(entry.key);
+  }
+  unsigned value = 1;
+  for (int i = 0; i < 100000; i++) {
+    value = value * 1103515245u + 12345u;
+    int key = (value >> 8) % capacity;
+    lru.splice(lru.cbegin(), lru, lru.iterator_to(entries[key]));
+    auto it = reference.begin();
+    while (*it != key) ++it;
+    reference.erase(it);
+    reference.push_front(key);
+  }
+  std::vector<int> expected;
+  for (int key : reference) expected.push_back(key);
+  EXPECT_EQ(lru_keys(lru), expected);
+  EXPECT_EQ(lru.size(), capacity);
+}
+
 // // QUEUE
 
 template <typename value_type>
@@ -1722,6 +3986,131 @@ TEST(QueueTest, Swap_3) {
   }
 }
 
+// RING BUFFER
+
+TEST(RingBufferTest, CapacityIsPowerOfTwo) {
+  s21::ring_buffer<int> buffer(100);
+  EXPECT_EQ(buffer.capacity(), 128);
+  EXPECT_TRUE(buffer.empty());
+  EXPECT_EQ(s21::ring_buffer<int>(64).capacity(), 64);
+  EXPECT_EQ(s21::ring_buffer<int>(1).capacity(), 1);
+  EXPECT_EQ(s21::ring_buffer<int>().capacity(), 0);
+  EXPECT_THROW(s21::ring_buffer<int>(SIZE_MAX), std::length_error);
+}
+
+TEST(RingBufferTest, PushPopWrapsAround) {
+  s21::ring_buffer<int> buffer(8);
+  std::queue<int> expected;
+  for (int i = 0; i < 1000; i++) {
+    buffer.push_back(i);
+    expected.push(i);
+    if (i % 3 != 0) {
+      EXPECT_EQ(buffer.front(), expected.front());
+      buffer.pop_front();
+      expected.pop();
+    }
+    if (buffer.full()) {
+      while (!buffer.empty()) {
+        EXPECT_EQ(buffer.front(), expected.front());
+        buffer.pop_front();
+        expected.pop();
+      }
+    }
+    EXPECT_EQ(buffer.size(), expected.size());
+  }
+}
+
+TEST(RingBufferTest, BoundedThrowsWhenFull) {
+  s21::ring_buffer<std::string> buffer(4);
+  for (int i = 0; i < 4; i++) buffer.push_back(std::to_string(i));
+  EXPECT_TRUE(buffer.full());
+  EXPECT_THROW(buffer.push_back("4"), std::length_error);
+  EXPECT_EQ(buffer.size(), 4);
+  EXPECT_EQ(buffer.front(), "0");
+  EXPECT_EQ(buffer.back(), "3");
+  EXPECT_THROW(s21::ring_buffer<int>().push_back(1), std::length_error);
+}
+
+TEST(RingBufferTest, OverwriteDropsOldest) {
+  s21::ring_buffer<std::string> buffer(4, s21::ring_mode::overwrite);
+  for (int i = 0; i < 10; i++) buffer.push_back(std::to_string(i));
+  EXPECT_EQ(buffer.size(), 4);
+  for (size_t i = 0; i < buffer.size(); i++)
+    EXPECT_EQ(buffer[i], std::to_string(6 + i));
+  EXPECT_EQ(buffer.emplace_back(3, 'x'), "xxx");
+  EXPECT_EQ(buffer.front(), "7");
+}
+
+TEST(RingBufferTest, SpansCoverContentsInOrder) {
+  s21::ring_buffer<int> buffer(8);
+  for (int i = 0; i < 6; i++) buffer.push_back(i);
+  auto spans = buffer.spans();
+  EXPECT_EQ(spans.first.size(), 6);
+  EXPECT_TRUE(spans.second.empty());
+  buffer.pop_front(5);
+  for (int i = 6; i < 12; i++) buffer.push_back(i);
+  const auto &const_buffer = buffer;
+  auto wrapped = const_buffer.spans();
+  EXPECT_EQ(wrapped.first.size(), 3);
+  EXPECT_EQ(wrapped.second.size(), 4);
+  EXPECT_EQ(wrapped.first.data() + 3, wrapped.second.data() + 8);
+  std::vector<int> read(wrapped.first.begin(), wrapped.first.end());
+  read.insert(read.end(), wrapped.second.begin(), wrapped.second.end());
+  std::vector<int> expected = {5, 6, 7, 8, 9, 10, 11};
+  EXPECT_EQ(read, expected);
+  EXPECT_TRUE(std::equal(buffer.cbegin(), buffer.cend(), expected.begin()));
+}
+
+TEST(RingBufferTest, AccessAndPopErrors) {
+  s21::ring_buffer<int> buffer = {1, 2, 3};
+  EXPECT_EQ(buffer.capacity(), 4);
+  EXPECT_EQ(buffer.at(2), 3);
+  EXPECT_THROW(buffer.at(3), std::out_of_range);
+  buffer.pop_back();
+  EXPECT_EQ(buffer.back(), 2);
+  EXPECT_THROW(buffer.pop_front(3), std::out_of_range);
+  buffer.clear();
+  EXPECT_THROW(buffer.front(), std::out_of_range);
+  EXPECT_THROW(buffer.pop_front(), std::out_of_range);
+}
+
+TEST(RingBufferTest, CopyMoveSwap) {
+  s21::ring_buffer<std::string> buffer(4, s21::ring_mode::overwrite);
+  for (int i = 0; i < 6; i++) buffer.push_back(std::to_string(i));
+  s21::ring_buffer<std::string> copy(buffer);
+  EXPECT_EQ(copy.mode(), s21::ring_mode::overwrite);
+  EXPECT_TRUE(std::equal(copy.begin(), copy.end(), buffer.begin()));
+  s21::ring_buffer<std::string> moved(std::move(copy));
+  EXPECT_EQ(copy.capacity(), 0);
+  EXPECT_EQ(moved.front(), "2");
+  s21::ring_buffer<std::string> other(2);
+  other.push_back("a");
+  other.swap(moved);
+  EXPECT_EQ(other.size(), 4);
+  EXPECT_EQ(moved.front(), "a");
+  moved = other;
+  EXPECT_EQ(moved.back(), "5");
+}
+
+TEST(RingBufferTest, AsQueueContainer) {
+  s21::queue<int, s21::ring_buffer<int>> queue(s21::ring_buffer<int>(64));
+  std::queue<int> expected;
+  for (int i = 0; i < 100; i++) {
+    queue.push(i);
+    expected.push(i);
+    EXPECT_EQ(queue.back(), expected.back());
+    if (i % 2 == 0) {
+      EXPECT_EQ(queue.front(), expected.front());
+      queue.pop();
+      expected.pop();
+    }
+  }
+  EXPECT_EQ(queue.size(), expected.size());
+  s21::queue<int, s21::ring_buffer<int>> listed = {1, 2, 3};
+  EXPECT_EQ(listed.front(), 1);
+  EXPECT_EQ(listed.back(), 3);
+}
+
 // SET
 
 TEST(setTest, DefaultConstructor) {
@@ -2663,6 +5052,250 @@ TEST(mapTest, Contains_2) {
   EXPECT_EQ(s21_map.contains(0), false);
 }
 
+TEST(mapTest, Empty_map_no_allocations) {
+  using Pair = std::pair<int, int>;
+  using Map = s21::map<int, int, std::less<int>, CountingAllocator<Pair>>;
+  static_assert(std::is_nothrow_default_constructible<Map>::value, "");
+  static_assert(
+      std::is_nothrow_default_constructible<s21::set<int>>::value, "");
+  CountingAllocator<Pair>::allocations = 0;
+  CountingAllocator<s21::RBNode<int, int>>::allocations = 0;
+  Map m1;
+  Map m2(std::move(m1));
+  m2.clear();
+  m1.swap(m2);
+  EXPECT_EQ(CountingAllocator<Pair>::allocations, 0);
+  EXPECT_EQ((CountingAllocator<s21::RBNode<int, int>>::allocations), 0);
+  EXPECT_EQ(m1.begin(), m1.end());
+}
+
+TEST(mapTest, Non_default_constructible) {
+  s21::map<int, NoDefault> m;
+  m.insert(2, NoDefault(20));
+  m.insert(std::make_pair(1, NoDefault(10)));
+  EXPECT_EQ(m.at(1).value, 10);
+  EXPECT_EQ(m.begin()->second.value, 10);
+  EXPECT_EQ(m.size(), 2);
+  s21::set<NoDefault> s;
+  s.insert(NoDefault(3));
+  s.insert(NoDefault(1));
+  EXPECT_EQ((*s.begin()).value, 1);
+}
+
+TEST(mapTest, Swap_and_move_relink_root) {
+  s21::map<int, int> m1{{1, 1}, {2, 2}, {3, 3}};
+  s21::map<int, int> m2;
+  m1.swap(m2);
+  EXPECT_EQ(m1.begin(), m1.end());
+  s21::map<int, int> m3;
+  {
+    s21::map<int, int> moved(std::move(m2));
+    m3.swap(moved);
+  }
+  int sum = 0;
+  for (auto it = m3.begin(); it != m3.end(); ++it) sum += it->second;
+  EXPECT_EQ(sum, 6);
+  m3.insert(0, 0);
+  m3.erase(m3.begin());
+  m3.erase(m3.begin());
+  m3.erase(m3.begin());
+  m3.erase(m3.begin());
+  EXPECT_TRUE(m3.empty());
+  m3.insert(4, 4);
+  m1.insert(5, 5);
+  EXPECT_EQ(m3.begin()->first, 4);
+  EXPECT_EQ(m1.begin()->first, 5);
+}
+
+// FLAT MAP
+
+// std::map holds pair<const Key, T>, flat_map holds pair<Key, T>.
+const auto PairsEqual = [](const auto& lhs, const auto& rhs) {
+  return lhs.first == rhs.first && lhs.second == rhs.second;
+};
+
+TEST(flatMapTest, InitializerListConstructor) {
+  s21::flat_map<int, std::string> s21_map = {
+      {3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}};
+  std::map<int, std::string> std_map = {
+      {3, "three"}, {1, "one"}, {2, "two"}, {1, "uno"}};
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  auto it = s21_map.cbegin();
+  for (const auto& item : std_map) {
+    EXPECT_EQ(it->first, item.first);
+    EXPECT_EQ(it->second, item.second);
+    ++it;
+  }
+}
+
+TEST(flatMapTest, RangeConstructor) {
+  std::vector<std::pair<int, int>> items;
+  for (int i = 0; i < 1000; i++) items.push_back({i * 7919 % 500, i});
+  s21::flat_map<int, int> s21_map(items.begin(), items.end());
+  std::map<int, int> std_map(items.begin(), items.end());
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  EXPECT_TRUE(std::equal(std_map.begin(), std_map.end(), s21_map.cbegin(),
+                         PairsEqual));
+}
+
+TEST(flatMapTest, InsertAndFind) {
+  s21::flat_map<int, int> s21_map;
+  std::map<int, int> std_map;
+  for (int i = 0; i < 1000; i++) {
+    int key = i * 7919 % 601;
+    auto s21_res = s21_map.insert(key, i);
+    auto std_res = std_map.insert({key, i});
+    EXPECT_EQ(s21_res.second, std_res.second);
+    EXPECT_EQ(s21_res.first->second, std_res.first->second);
+  }
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  EXPECT_TRUE(std::equal(std_map.begin(), std_map.end(), s21_map.cbegin(),
+                         PairsEqual));
+  for (int key = -10; key < 700; key++) {
+    EXPECT_EQ(s21_map.contains(key), std_map.count(key) == 1);
+    auto it = s21_map.find(key);
+    if (std_map.count(key) == 1)
+      EXPECT_EQ(it->second, std_map[key]);
+    else
+      EXPECT_EQ(it, s21_map.end());
+  }
+}
+
+TEST(flatMapTest, RangeInsert) {
+  s21::flat_map<int, int> s21_map = {{1, 1}, {5, 5}, {9, 9}};
+  std::map<int, int> std_map = {{1, 1}, {5, 5}, {9, 9}};
+  std::vector<std::pair<int, int>> items = {
+      {7, 0}, {5, 0}, {0, 0}, {7, 1}, {12, 0}, {3, 0}};
+  s21_map.insert(items.begin(), items.end());
+  std_map.insert(items.begin(), items.end());
+  EXPECT_EQ(s21_map.size(), std_map.size());
+  EXPECT_TRUE(std::equal(std_map.begin(), std_map.end(), s21_map.cbegin(),
+                         PairsEqual));
+}
+
+TEST(flatMapTest, AtAndOperatorBrackets) {
+  s21::flat_map<std::string, int> map = {{"one", 1}, {"two", 2}};
+  EXPECT_EQ(map.at("one"), 1);
+  map["three"] = 3;
+  map["one"] = 10;
+  EXPECT_EQ(map.size(), 3);
+  EXPECT_EQ(map.at("three"), 3);
+  EXPECT_EQ(map["one"], 10);
+  EXPECT_THROW(map.at("four"), std::out_of_range);
+  const auto& const_map = map;
+  EXPECT_EQ(const_map.at("two"), 2);
+  EXPECT_THROW(const_map.at("five"), std::out_of_range);
+}
+
+TEST(flatMapTest, InsertOrAssign) {
+  s21::flat_map<int, std::string> map = {{1, "one"}};
+  auto res = map.insert_or_assign(1, "uno");
+  EXPECT_FALSE(res.second);
+  EXPECT_EQ(map.at(1), "uno");
+  res = map.insert_or_assign(2, "dos");
+  EXPECT_TRUE(res.second);
+  EXPECT_EQ(res.first->second, "dos");
+}
+
+TEST(flatMapTest, Erase) {
+  s21::flat_map<int, int> map = {{1, 1}, {2, 2}, {3, 3}};
+  map.erase(map.find(2));
+  EXPECT_EQ(map.size(), 2);
+  EXPECT_FALSE(map.contains(2));
+  EXPECT_THROW(map.erase(map.end()), std::out_of_range);
+}
+
+TEST(flatMapTest, Merge) {
+  s21::flat_map<int, std::string> map1 = {{1, "one"}, {3, "three"}};
+  s21::flat_map<int, std::string> map2 = {
+      {0, "zero"}, {3, "drei"}, {4, "four"}};
+  map1.merge(map2);
+  EXPECT_EQ(map1.size(), 4);
+  EXPECT_TRUE(map2.empty());
+  EXPECT_EQ(map1.at(0), "zero");
+  EXPECT_EQ(map1.at(3), "three");
+  EXPECT_EQ(map1.at(4), "four");
+  EXPECT_TRUE(std::is_sorted(map1.begin(), map1.end()));
+}
+
+TEST(flatMapTest, Swap) {
+  s21::flat_map<int, int> map1 = {{1, 1}};
+  s21::flat_map<int, int> map2 = {{2, 2}, {3, 3}};
+  map1.swap(map2);
+  EXPECT_EQ(map1.size(), 2);
+  EXPECT_EQ(map2.size(), 1);
+  EXPECT_TRUE(map2.contains(1));
+}
+
+TEST(flatMapTest, CustomCompare) {
+  s21::flat_map<int, int, std::greater<int>> map = {{1, 1}, {3, 3}, {2, 2}};
+  int expected = 3;
+  for (auto it = map.begin(); it != map.end(); ++it)
+    EXPECT_EQ(it->first, expected--);
+  EXPECT_TRUE(map.contains(2));
+  EXPECT_FALSE(map.contains(4));
+}
+
+// FLAT SET
+
+TEST(flatSetTest, InitializerListConstructor) {
+  s21::flat_set<char> s21_set = {'d', 'a', 'b', 'c', 'a', 'b', 'f'};
+  std::set<char> std_set = {'d', 'a', 'b', 'c', 'a', 'b', 'f'};
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_set.cbegin()));
+}
+
+TEST(flatSetTest, InsertAndFind) {
+  s21::flat_set<int> s21_set;
+  std::set<int> std_set;
+  for (int i = 0; i < 1000; i++) {
+    int key = i * 7919 % 601;
+    auto s21_res = s21_set.insert(key);
+    EXPECT_EQ(s21_res.second, std_set.insert(key).second);
+    EXPECT_EQ(*s21_res.first, key);
+  }
+  EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_set.cbegin()));
+  for (int key = -10; key < 700; key++) {
+    EXPECT_EQ(s21_set.contains(key), std_set.count(key) == 1);
+    EXPECT_EQ(s21_set.find(key) != s21_set.end(), std_set.count(key) == 1);
+  }
+}
+
+TEST(flatSetTest, RangeInsert) {
+  s21::flat_set<int> s21_set = {1, 5, 9};
+  std::set<int> std_set = {1, 5, 9};
+  std::vector<int> items = {7, 5, 0, 7, 12, 3};
+  s21_set.insert(items.begin(), items.end());
+  std_set.insert(items.begin(), items.end());
+  EXPECT_EQ(s21_set.size(), std_set.size());
+  EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_set.cbegin()));
+}
+
+TEST(flatSetTest, Erase) {
+  s21::flat_set<int> s = {1, 2, 3};
+  s.erase(s.find(1));
+  EXPECT_EQ(s.size(), 2);
+  EXPECT_EQ(*s.begin(), 2);
+}
+
+TEST(flatSetTest, Merge) {
+  s21::flat_set<int> s21_set_1 = {1, 2, 3};
+  s21::flat_set<int> s21_set_2 = {3, 4, 5, 6};
+  s21_set_1.merge(s21_set_2);
+  std::set<int> std_set = {1, 2, 3, 4, 5, 6};
+  EXPECT_EQ(s21_set_1.size(), std_set.size());
+  EXPECT_TRUE(s21_set_2.empty());
+  EXPECT_TRUE(std::equal(std_set.begin(), std_set.end(), s21_set_1.cbegin()));
+}
+
+TEST(flatSetTest, Swap) {
+  s21::flat_set<int> s1 = {1, 2};
+  s21::flat_set<int> s2 = {3};
+  s1.swap(s2);
+  EXPECT_EQ(s1.size(), 1);
+  EXPECT_TRUE(s2.contains(2));
+}
+
 int main(int argc, char* argv[]) {
   testing::InitGoogleTest(&argc, argv);
   return RUN_ALL_TESTS();